@@ -0,0 +1,32 @@
+#!/bin/bash
+
+# Writes the netlist of the design in binary AIGER format, then checks
+# the design and the AIGER file with the same options. Fails unless
+# both checks give the same exit code.
+
+set -e
+
+ebmc=$1
+shift
+options=("${@:1:$#-1}")
+design=${!#}
+aig="${design%.*}.aig"
+
+"$ebmc" "$design" --aiger-netlist "$aig"
+
+set +e
+
+"$ebmc" "${options[@]}" "$design"
+design_exit=$?
+
+"$ebmc" "${options[@]}" "$aig"
+aig_exit=$?
+
+rm -f "$aig"
+
+if [ $design_exit -ne $aig_exit ]; then
+  echo "exit codes differ: $design_exit for the design, $aig_exit for AIGER"
+  exit 1
+fi
+
+exit $design_exit
@@ -0,0 +1,15 @@
+module main(input clk, input [3:0] in);
+
+  reg [3:0] x, y;
+
+  initial x = 0;
+  initial y = 0;
+
+  always @(posedge clk) begin
+    x <= x + in;
+    y <= in + y;
+  end
+
+  p0: assert property (x == y);
+
+endmodule
@@ -0,0 +1,36 @@
+#!/bin/bash
+
+# Checks the design twice with a fresh symbol table cache, in a copy of
+# the test directory. With --modify file, the given file is changed
+# between the two runs. The output of each run is prefixed with
+# "run 1: " or "run 2: ", and the exit code is that of the second run.
+
+set -e
+
+# the tests run in another directory
+ebmc=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+shift
+
+modify=""
+if [ "$1" = "--modify" ]; then
+  modify=$2
+  shift 2
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+cp -R . "$work"
+cd "$work"
+
+set +e
+set -o pipefail
+
+"$ebmc" --cache-dir cache "$@" 2>&1 | sed 's/^/run 1: /'
+
+if [ -n "$modify" ]; then
+  echo "// modified" >> "$modify"
+fi
+
+"$ebmc" --cache-dir cache "$@" 2>&1 | sed 's/^/run 2: /'
+exit $?
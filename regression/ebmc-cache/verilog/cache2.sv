@@ -0,0 +1,12 @@
+module main(input clk);
+
+  reg [3:0] counter;
+
+  initial counter = 0;
+
+  always @(posedge clk)
+    counter <= counter + 1;
+
+  p1: assert property (counter != 10);
+
+endmodule
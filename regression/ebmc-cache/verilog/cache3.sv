@@ -0,0 +1,14 @@
+`include "cache3.vh"
+
+module main(input clk);
+
+  reg [3:0] counter;
+
+  initial counter = 0;
+
+  always @(posedge clk)
+    counter <= counter + `STEP;
+
+  p1: assert property (counter != 10);
+
+endmodule
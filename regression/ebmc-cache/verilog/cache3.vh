@@ -0,0 +1 @@
+`define STEP 1
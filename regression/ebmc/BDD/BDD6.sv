@@ -0,0 +1,18 @@
+module main(input clk, input [7:0] in);
+
+  reg [7:0] stage1, stage2, stage3;
+
+  initial stage1 = 0;
+  initial stage2 = 0;
+  initial stage3 = 0;
+
+  always @(posedge clk) begin
+    stage1 <= in & 8'h0f;
+    stage2 <= stage1;
+    stage3 <= stage2;
+  end
+
+  p1: assert property (stage3 <= 15);
+  p2: assert property (stage3 <= 7);
+
+endmodule
@@ -0,0 +1,18 @@
+module main(input clk, input reset);
+
+  reg [3:0] counter;
+
+  initial counter = 0;
+
+  always @(posedge clk)
+    if(reset || counter == 9)
+      counter <= 0;
+    else
+      counter <= counter + 1;
+
+  p1: assert property (counter <= 9);
+  p2: assert property (counter != 12);
+  p3: assert property (counter != 5);
+  p4: assert property (counter <= 4);
+
+endmodule
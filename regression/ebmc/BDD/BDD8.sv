@@ -0,0 +1,16 @@
+module main(input clk, input [7:0] a, input [7:0] b);
+
+  // two registers compared bit by bit
+  reg [7:0] x, y;
+
+  initial x = 0;
+  initial y = 0;
+
+  always @(posedge clk) begin
+    x <= a;
+    y <= a;
+  end
+
+  p1: assert property (x == y);
+
+endmodule
@@ -0,0 +1,18 @@
+module main(input clk, input [7:0] a);
+
+  // y holds the bits of x in reverse order
+  reg [7:0] x, y;
+
+  initial x = 0;
+  initial y = 0;
+
+  always @(posedge clk) begin
+    x <= a;
+    y <= {a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]};
+  end
+
+  p1: assert property (x == {y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7]});
+
+  p2: assert property (x != 8'hff);
+
+endmodule
@@ -0,0 +1,22 @@
+module main(input clock);
+
+  reg [3:0] x;
+
+  initial x = 0;
+
+  always @(posedge clock)
+    if(x == 10)
+      x <= 0;
+    else
+      x <= x + 1;
+
+  // holds
+  p0: assert property (x <= 10);
+
+  // fails
+  p1: assert property (x != 7);
+
+  // holds
+  p2: assert property (x != 12);
+
+endmodule
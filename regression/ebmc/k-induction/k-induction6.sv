@@ -0,0 +1,21 @@
+module main(input clk);
+
+  reg x0, x1, x2;
+
+  initial x0 = 0;
+  initial x1 = 0;
+  initial x2 = 0;
+
+  always @(posedge clk) begin
+    x0 <= 0;
+    x1 <= x0;
+    x2 <= x1;
+  end
+
+  // 3-inductive, but not 2-inductive
+  p1: assert property (x2 == 0);
+
+  // refuted in the base case
+  p2: assert property (x0 == x1 && x1 == x2 && x2 == 1);
+
+endmodule
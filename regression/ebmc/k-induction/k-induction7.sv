@@ -0,0 +1,20 @@
+module main(input clk, input in);
+
+  reg [1:0] x;
+
+  initial x = 0;
+
+  // states 2 and 3 are unreachable
+  always @(posedge clk)
+    case(x)
+      0: x = 1;
+      1: x = 0;
+      2: x = in ? 3 : 2;
+      3: x = 3;
+    endcase
+
+  // not k-inductive for any k, owing to the self-loop on 2,
+  // but 2-inductive with simple-path constraints
+  p0: assert property (x != 3);
+
+endmodule
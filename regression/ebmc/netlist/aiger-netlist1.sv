@@ -0,0 +1,12 @@
+module main(input clk);
+
+  reg x;
+
+  initial x = 0;
+
+  always @(posedge clk)
+    x <= !x;
+
+  p0: assert property (x == 0);
+
+endmodule
@@ -0,0 +1,18 @@
+module main(input clk, input enable);
+
+  reg [7:0] counter;
+  reg [31:0] unrelated;
+
+  initial counter = 0;
+  initial unrelated = 0;
+
+  always @(posedge clk) begin
+    if(enable)
+      counter = counter + 1;
+    unrelated = unrelated * 3 + 1;
+  end
+
+  // does not depend on 'unrelated'
+  assert property (counter != 3);
+
+endmodule
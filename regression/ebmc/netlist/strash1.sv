@@ -0,0 +1,16 @@
+module main(input clk, input [7:0] a, input [7:0] b);
+
+  reg [7:0] x, y;
+
+  initial x = 0;
+  initial y = 0;
+
+  // the same AND gates, with swapped fanins
+  always @(posedge clk) begin
+    x = a & b;
+    y = b & a;
+  end
+
+  assert property (x == y);
+
+endmodule
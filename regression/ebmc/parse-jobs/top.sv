@@ -0,0 +1,10 @@
+module main(input clk);
+
+  wire [7:0] out1, out2;
+
+  counter c1(clk, out1);
+  counter c2(clk, out2);
+
+  p1: assert property (out1 == out2);
+
+endmodule
@@ -0,0 +1,16 @@
+module main(input clk);
+
+  reg [3:0] x;
+
+  initial x = 0;
+
+  always @(posedge clk)
+    x <= x == 9 ? 0 : x + 1;
+
+  // not 1-inductive, but proved by the BDD engine
+  p0: assert property (x != 12);
+
+  // refuted
+  p1: assert property (x != 5);
+
+endmodule
@@ -0,0 +1,19 @@
+#!/bin/bash
+
+# Checks the design with IC3 and writes the invariants found, then
+# checks the invariants that were written. The output of each run is
+# prefixed with "run 1: " or "run 2: ", and the exit code is that of
+# the second run.
+
+ebmc=$1
+shift
+
+invariant=$(mktemp)
+trap 'rm -f "$invariant"' EXIT
+
+set -o pipefail
+
+"$ebmc" "$@" --write-invariant "$invariant" 2>&1 | sed 's/^/run 1: /'
+
+"$ebmc" "$@" --check-invariant "$invariant" 2>&1 | sed 's/^/run 2: /'
+exit $?
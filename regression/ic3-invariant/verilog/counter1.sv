@@ -0,0 +1,17 @@
+module main(input clock);
+
+  reg [3:0] x;
+
+  initial x = 0;
+
+  always @(posedge clock)
+    if(x == 10)
+      x <= 0;
+    else
+      x <= x + 1;
+
+  p0: assert property (x <= 10);
+
+  p1: assert property (x != 12);
+
+endmodule
@@ -0,0 +1,36 @@
+module leaf;
+
+  parameter W = 1;
+
+  wire [W-1:0] all_ones = -1;
+
+endmodule
+
+module my_module;
+
+  parameter some_parameter = 7;
+
+  wire [some_parameter:0] some_wire = -1;
+
+  leaf #(some_parameter) l();
+
+endmodule
+
+module main;
+
+  my_module m1();
+  my_module #(.some_parameter(3)) m2();
+  my_module #(1) m3();
+  my_module #(3) m4();
+  my_module #(5) m5();
+
+  defparam m1.some_parameter = 2;
+
+  always assert p1: m1.some_wire==7;
+  always assert p2: m2.some_wire==15;
+  always assert p3: m3.some_wire==3;
+  always assert p4: m4.some_wire==15;
+  always assert p5: m5.some_wire==63;
+  always assert p6: m5.l.all_ones==31;
+
+endmodule
@@ -9,6 +9,75 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "aiger_language.h"
 
 #include <util/message.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+
+#include "aiger_parser.h"
+#include "aiger_typecheck.h"
+
+#include <iterator>
+#include <ostream>
+
+#ifndef _WIN32
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+/// The AIG is a single module.
+static const char aiger_module[] = "aiger::main";
+
+/*******************************************************************\
+
+   Class: mapped_filet
+
+ Purpose: read-only memory mapping of a file, which avoids
+          copying large binary AND sections
+
+\*******************************************************************/
+
+class mapped_filet
+{
+public:
+  explicit mapped_filet(const std::string &path)
+  {
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd == -1)
+      return;
+
+    struct stat st;
+    if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size != 0)
+    {
+      void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(addr != MAP_FAILED)
+      {
+        madvise(addr, st.st_size, MADV_SEQUENTIAL);
+        data = static_cast<const char *>(addr);
+        size = st.st_size;
+      }
+    }
+
+    close(fd);
+#endif
+  }
+
+  ~mapped_filet()
+  {
+#ifndef _WIN32
+    if(data != nullptr)
+      munmap(const_cast<char *>(data), size);
+#endif
+  }
+
+  mapped_filet(const mapped_filet &) = delete;
+  mapped_filet &operator=(const mapped_filet &) = delete;
+
+  const char *data = nullptr;
+  std::size_t size = 0;
+};
 
 /*******************************************************************\
 
@@ -23,11 +92,36 @@ Function: aiger_languaget::parse
 \*******************************************************************/
 
 bool aiger_languaget::parse(
-  std::istream &,
-  const std::string &,
-  message_handlert &)
+  std::istream &instream,
+  const std::string &path,
+  message_handlert &message_handler)
 {
-  return true;
+  try
+  {
+    mapped_filet mapped_file(path);
+
+    if(mapped_file.data != nullptr)
+    {
+      aiger_parse(
+        mapped_file.data, mapped_file.data + mapped_file.size, parse_tree);
+    }
+    else
+    {
+      // not a regular file, read the stream
+      std::string data(
+        (std::istreambuf_iterator<char>(instream)),
+        std::istreambuf_iterator<char>());
+      aiger_parse(data.data(), data.data() + data.size(), parse_tree);
+    }
+  }
+  catch(const std::string &error_str)
+  {
+    messaget message(message_handler);
+    message.error() << path << ": " << error_str << messaget::eom;
+    return true;
+  }
+
+  return false;
 }
 
 /*******************************************************************\
@@ -86,6 +180,7 @@ Function: aiger_languaget::modules_provided
 void aiger_languaget::modules_provided(
   std::set<std::string> &module_set)
 {
+  module_set.insert(aiger_module);
 }
              
 /*******************************************************************\
@@ -101,11 +196,14 @@ Function: aiger_languaget::typecheck
 \*******************************************************************/
 
 bool aiger_languaget::typecheck(
-  symbol_table_baset &,
-  const std::string &,
-  message_handlert &)
+  symbol_table_baset &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler)
 {
-  return true;
+  if(module != aiger_module)
+    return false;
+
+  return aiger_typecheck(parse_tree, symbol_table, module, message_handler);
 }
 
 /*******************************************************************\
@@ -137,8 +235,62 @@ Function: aiger_languaget::show_parse
 
 \*******************************************************************/
 
-void aiger_languaget::show_parse(std::ostream &, message_handlert &)
+void aiger_languaget::show_parse(std::ostream &out, message_handlert &)
 {
+  parse_tree.show(out);
+}
+
+/*******************************************************************\
+
+Function: expr2aiger
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static std::string expr2aiger(const exprt &expr, const namespacet &ns)
+{
+  if(expr.is_true())
+    return "1";
+  else if(expr.is_false())
+    return "0";
+  else if(expr.id() == ID_symbol)
+  {
+    const symbolt *symbol;
+    if(ns.lookup(to_symbol_expr(expr).get_identifier(), symbol))
+      return id2string(to_symbol_expr(expr).get_identifier());
+    else
+      return id2string(symbol->display_name());
+  }
+  else if(expr.id() == ID_not)
+    return "!" + expr2aiger(to_not_expr(expr).op(), ns);
+  else if(
+    expr.id() == ID_and || expr.id() == ID_or || expr.id() == ID_equal)
+  {
+    const char *op = expr.id() == ID_and  ? " & "
+                     : expr.id() == ID_or ? " | "
+                                          : " = ";
+    std::string result;
+    for(auto &operand : expr.operands())
+    {
+      if(!result.empty())
+        result += op;
+      result += expr2aiger(operand, ns);
+    }
+    return "(" + result + ")";
+  }
+  else if(expr.operands().size() == 1)
+  {
+    // temporal operators
+    return id2string(expr.id()) + " " +
+           expr2aiger(to_unary_expr(expr).op(), ns);
+  }
+  else
+    return expr.id_string();
 }
 
 /*******************************************************************\
@@ -158,7 +310,8 @@ bool aiger_languaget::from_expr(
   std::string &code,
   const namespacet &ns)
 {
-  return true;
+  code = expr2aiger(expr, ns);
+  return false;
 }
 
 /*******************************************************************\
@@ -178,6 +331,12 @@ bool aiger_languaget::from_type(
   std::string &code,
   const namespacet &ns)
 {
+  if(type.id() == ID_bool)
+  {
+    code = "bool";
+    return false;
+  }
+
   return true;
 }
 
@@ -13,6 +13,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <langapi/language.h>
 
+#include "aiger_parse_tree.h"
+
 class aiger_languaget:public languaget
 {
 public:
@@ -74,12 +76,20 @@ public:
 
   std::set<std::string> extensions() const override
   { 
-    return { "aig" };
+    return {"aig", "aag"};
   }
 
   aiger_languaget()
   {
   }
+
+  aiger_parse_treet &get_parse_tree()
+  {
+    return parse_tree;
+  }
+
+protected:
+  aiger_parse_treet parse_tree;
 };
  
 std::unique_ptr<languaget> new_aiger_language();
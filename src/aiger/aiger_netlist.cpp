@@ -0,0 +1,288 @@
+/*******************************************************************\
+
+Module: AIGER to Netlist
+
+\*******************************************************************/
+
+#include "aiger_netlist.h"
+
+#include <util/std_types.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+/*******************************************************************\
+
+   Class: aiger_netlistt
+
+ Purpose:
+
+\*******************************************************************/
+
+class aiger_netlistt
+{
+public:
+  aiger_netlistt(
+    const aiger_parse_treet &_parse_tree,
+    const irep_idt &_module,
+    netlistt &_dest)
+    : parse_tree(_parse_tree), module(_module), dest(_dest)
+  {
+  }
+
+  void operator()();
+
+protected:
+  using aiger_literalt = aiger_parse_treet::literalt;
+
+  const aiger_parse_treet &parse_tree;
+  const irep_idt module;
+  netlistt &dest;
+
+  enum class statet
+  {
+    UNDEFINED,
+    ON_STACK,
+    DONE
+  };
+
+  // the netlist literal of each AIGER variable, by variable number
+  std::vector<literalt> literals;
+  std::vector<statet> states;
+
+  // the index of the AND gate that defines a variable
+  static constexpr std::size_t no_gate =
+    std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> gates;
+
+  literalt literal(aiger_literalt) const;
+  void convert_gate(std::size_t var_no);
+
+  var_mapt::vart &
+  add_var(const std::string &suffix, var_mapt::vart::vartypet, literalt);
+};
+
+/*******************************************************************\
+
+Function: aiger_netlistt::literal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+literalt aiger_netlistt::literal(aiger_literalt lit) const
+{
+  // 0 is false and 1 is true
+  if(lit < 2)
+    return const_literal(lit != 0);
+
+  return literals[lit >> 1] ^ ((lit & 1) != 0);
+}
+
+/*******************************************************************\
+
+Function: aiger_netlistt::convert_gate
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Adds the AND node of a variable, after those of its
+          operands, as the AND gates of an ASCII file need not be
+          in topological order
+
+\*******************************************************************/
+
+void aiger_netlistt::convert_gate(std::size_t var_no)
+{
+  std::vector<std::size_t> stack{var_no};
+
+  while(!stack.empty())
+  {
+    const auto v = stack.back();
+
+    if(states[v] == statet::DONE)
+    {
+      stack.pop_back();
+      continue;
+    }
+
+    states[v] = statet::ON_STACK;
+
+    const auto &gate = parse_tree.ands[gates[v]];
+    bool ready = true;
+
+    for(auto rhs : {gate.rhs0, gate.rhs1})
+    {
+      const auto u = rhs >> 1;
+
+      if(u == 0 || states[u] == statet::DONE)
+        continue;
+      else if(states[u] == statet::ON_STACK)
+        throw "AND gate " + std::to_string(u) + " depends on itself";
+      else if(gates[u] == no_gate)
+        throw "literal " + std::to_string(rhs) + " is undefined";
+
+      stack.push_back(u);
+      ready = false;
+    }
+
+    if(ready)
+    {
+      literals[v] =
+        dest.new_and_node_strash(literal(gate.rhs0), literal(gate.rhs1));
+      states[v] = statet::DONE;
+      stack.pop_back();
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: aiger_netlistt::add_var
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+var_mapt::vart &aiger_netlistt::add_var(
+  const std::string &suffix,
+  var_mapt::vart::vartypet vartype,
+  literalt current)
+{
+  var_mapt::vart &var = dest.var_map.map[id2string(module) + "::" + suffix];
+  var.vartype = vartype;
+  var.type = bool_typet();
+  var.mode = "AIGER";
+
+  auto &bit = var.add_bit();
+  bit.current = current;
+  bit.next = const_literal(false);
+
+  return var;
+}
+
+/*******************************************************************\
+
+Function: aiger_netlistt::operator()
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_netlistt::operator()()
+{
+  const std::size_t size = parse_tree.max_var + 1;
+  literals.resize(size, const_literal(false));
+  states.resize(size, statet::UNDEFINED);
+  gates.resize(size, no_gate);
+
+  // the variable nodes come first, as in the AIGER file
+  for(std::size_t i = 0; i < parse_tree.inputs.size(); i++)
+  {
+    auto var_no = parse_tree.inputs[i] >> 1;
+    literals[var_no] = dest.new_var_node();
+    states[var_no] = statet::DONE;
+    add_var(
+      "i" + std::to_string(i),
+      var_mapt::vart::vartypet::INPUT,
+      literals[var_no]);
+  }
+
+  for(auto &latch : parse_tree.latches)
+  {
+    auto var_no = latch.lit >> 1;
+    literals[var_no] = dest.new_var_node();
+    states[var_no] = statet::DONE;
+  }
+
+  for(std::size_t i = 0; i < parse_tree.ands.size(); i++)
+    gates[parse_tree.ands[i].lhs >> 1] = i;
+
+  for(auto &gate : parse_tree.ands)
+  {
+    auto var_no = gate.lhs >> 1;
+    convert_gate(var_no);
+    add_var(
+      "a" + std::to_string(var_no),
+      var_mapt::vart::vartypet::WIRE,
+      literals[var_no]);
+  }
+
+  for(std::size_t i = 0; i < parse_tree.latches.size(); i++)
+  {
+    const auto &latch = parse_tree.latches[i];
+    const literalt current = literal(latch.lit);
+
+    auto &var = add_var(
+      "l" + std::to_string(i), var_mapt::vart::vartypet::LATCH, current);
+    var.bits.front().next = literal(latch.next);
+
+    // an uninitialized latch has itself as reset value
+    if(latch.reset == 0)
+      dest.initial.push_back(!current);
+    else if(latch.reset == 1)
+      dest.initial.push_back(current);
+  }
+
+  dest.var_map.build_reverse_map();
+
+  // the environment constraints hold in all states
+  for(auto c : parse_tree.constraints)
+    dest.constraints.push_back(literal(c));
+
+  // bad-state properties; without those, the outputs are taken as
+  // bad-state properties, as in AIGER 1.0
+  for(std::size_t i = 0; i < parse_tree.bad.size(); i++)
+  {
+    dest.properties.emplace(
+      id2string(module) + "::b" + std::to_string(i),
+      netlistt::Gpt{!literal(parse_tree.bad[i])});
+  }
+
+  if(parse_tree.bad.empty() && parse_tree.justice.empty())
+  {
+    for(std::size_t i = 0; i < parse_tree.outputs.size(); i++)
+    {
+      dest.properties.emplace(
+        id2string(module) + "::o" + std::to_string(i),
+        netlistt::Gpt{!literal(parse_tree.outputs[i])});
+    }
+  }
+
+  // justice properties are neither G p nor G F p, and hence
+  // have no netlist form
+}
+
+/*******************************************************************\
+
+Function: aiger_netlist
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_netlist(
+  const aiger_parse_treet &parse_tree,
+  const irep_idt &module,
+  netlistt &dest)
+{
+  aiger_netlistt(parse_tree, module, dest)();
+}
@@ -0,0 +1,24 @@
+/*******************************************************************\
+
+Module: AIGER to Netlist
+
+\*******************************************************************/
+
+#ifndef CPROVER_AIGER_NETLIST_H
+#define CPROVER_AIGER_NETLIST_H
+
+#include <util/irep.h>
+
+#include <trans-netlist/netlist.h>
+
+#include "aiger_parse_tree.h"
+
+/// Builds the netlist of the AIG straight from its literals, with
+/// the variable names that aiger_typecheck gives to the module with
+/// the given name. Throws a string if the AND gates form a cycle.
+void aiger_netlist(
+  const aiger_parse_treet &,
+  const irep_idt &module,
+  netlistt &);
+
+#endif // CPROVER_AIGER_NETLIST_H
@@ -0,0 +1,71 @@
+/*******************************************************************\
+
+Module: AIGER Parse Tree
+
+\*******************************************************************/
+
+#include "aiger_parse_tree.h"
+
+#include <ostream>
+
+/*******************************************************************\
+
+Function: aiger_parse_treet::show
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parse_treet::show(std::ostream &out) const
+{
+  out << "MAXVAR " << max_var << '\n';
+
+  for(std::size_t i = 0; i < inputs.size(); i++)
+    out << "INPUT " << i << ": " << inputs[i] << '\n';
+
+  for(std::size_t i = 0; i < latches.size(); i++)
+  {
+    out << "LATCH " << i << ": " << latches[i].lit << " next "
+        << latches[i].next << " reset " << latches[i].reset << '\n';
+  }
+
+  for(std::size_t i = 0; i < outputs.size(); i++)
+    out << "OUTPUT " << i << ": " << outputs[i] << '\n';
+
+  for(std::size_t i = 0; i < bad.size(); i++)
+    out << "BAD " << i << ": " << bad[i] << '\n';
+
+  for(std::size_t i = 0; i < constraints.size(); i++)
+    out << "CONSTRAINT " << i << ": " << constraints[i] << '\n';
+
+  for(std::size_t i = 0; i < justice.size(); i++)
+  {
+    out << "JUSTICE " << i << ':';
+    for(auto l : justice[i])
+      out << ' ' << l;
+    out << '\n';
+  }
+
+  for(std::size_t i = 0; i < fairness.size(); i++)
+    out << "FAIRNESS " << i << ": " << fairness[i] << '\n';
+
+  for(auto &a : ands)
+    out << "AND " << a.lhs << " = " << a.rhs0 << " & " << a.rhs1 << '\n';
+
+  auto show_names = [&out](const char *section, const namest &names) {
+    for(auto &name : names)
+      out << "NAME " << section << name.first << ": " << name.second << '\n';
+  };
+
+  show_names("i", input_names);
+  show_names("l", latch_names);
+  show_names("o", output_names);
+  show_names("b", bad_names);
+  show_names("c", constraint_names);
+  show_names("j", justice_names);
+  show_names("f", fairness_names);
+}
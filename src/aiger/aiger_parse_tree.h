@@ -0,0 +1,71 @@
+/*******************************************************************\
+
+Module: AIGER Parse Tree
+
+\*******************************************************************/
+
+#ifndef CPROVER_AIGER_PARSE_TREE_H
+#define CPROVER_AIGER_PARSE_TREE_H
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// An and-inverter graph as given by an AIGER 1.9 file.
+/// Literals are encoded as in the file, i.e., 2*variable+sign,
+/// where 0 is constant false and 1 is constant true.
+class aiger_parse_treet
+{
+public:
+  using literalt = unsigned;
+
+  std::size_t max_var = 0;
+
+  std::vector<literalt> inputs;
+
+  struct latcht
+  {
+    literalt lit, next;
+
+    // 0, 1, or the latch literal itself for an uninitialized latch
+    literalt reset;
+  };
+
+  std::vector<latcht> latches;
+
+  std::vector<literalt> outputs, bad, constraints, fairness;
+
+  // each justice property is a set of literals that must
+  // hold infinitely often
+  std::vector<std::vector<literalt>> justice;
+
+  struct andt
+  {
+    literalt lhs, rhs0, rhs1;
+  };
+
+  std::vector<andt> ands;
+
+  // from the symbol table, indexed by position in the respective section
+  using namest = std::map<std::size_t, std::string>;
+  namest input_names, latch_names, output_names, bad_names, constraint_names,
+    justice_names, fairness_names;
+
+  std::string comment;
+
+  void clear()
+  {
+    *this = aiger_parse_treet();
+  }
+
+  void swap(aiger_parse_treet &other)
+  {
+    std::swap(*this, other);
+  }
+
+  void show(std::ostream &) const;
+};
+
+#endif // CPROVER_AIGER_PARSE_TREE_H
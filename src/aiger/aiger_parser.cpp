@@ -0,0 +1,482 @@
+/*******************************************************************\
+
+Module: AIGER Parser
+
+\*******************************************************************/
+
+#include "aiger_parser.h"
+
+#include <limits>
+
+/*******************************************************************\
+
+   Class: aiger_parsert
+
+ Purpose:
+
+\*******************************************************************/
+
+class aiger_parsert
+{
+public:
+  aiger_parsert(const char *begin, const char *_end, aiger_parse_treet &_dest)
+    : p(begin), end(_end), dest(_dest)
+  {
+  }
+
+  void parse();
+
+protected:
+  using literalt = aiger_parse_treet::literalt;
+
+  const char *p, *end;
+  aiger_parse_treet &dest;
+  std::size_t line_no = 1;
+  bool binary = false;
+
+  [[noreturn]] void error(const std::string &message) const
+  {
+    throw "line " + std::to_string(line_no) + ": " + message;
+  }
+
+  bool at_end() const
+  {
+    return p == end;
+  }
+
+  void expect(char ch, const char *what)
+  {
+    if(at_end() || *p != ch)
+      error(std::string("expected ") + what);
+    if(ch == '\n')
+      line_no++;
+    p++;
+  }
+
+  std::size_t read_number();
+  literalt read_literal();
+  literalt read_literal_line();
+  literalt read_delta();
+
+  void parse_header(std::size_t &I, std::size_t &L, std::size_t &O,
+                    std::size_t &A, std::size_t &B, std::size_t &C,
+                    std::size_t &J, std::size_t &F);
+  void parse_ands(std::size_t A);
+  void parse_symbols();
+};
+
+/*******************************************************************\
+
+Function: aiger_parsert::read_number
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t aiger_parsert::read_number()
+{
+  if(at_end() || *p < '0' || *p > '9')
+    error("expected number");
+
+  std::size_t result = 0;
+
+  while(!at_end() && *p >= '0' && *p <= '9')
+  {
+    std::size_t digit = *p - '0';
+    if(result > (std::numeric_limits<std::size_t>::max() - digit) / 10)
+      error("number too large");
+    result = result * 10 + digit;
+    p++;
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::read_literal
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+aiger_parsert::literalt aiger_parsert::read_literal()
+{
+  auto l = read_number();
+
+  if(l > 2 * dest.max_var + 1)
+    error("literal " + std::to_string(l) + " exceeds maximum variable index");
+
+  return literalt(l);
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::read_literal_line
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: a literal on a line by itself
+
+\*******************************************************************/
+
+aiger_parsert::literalt aiger_parsert::read_literal_line()
+{
+  auto l = read_literal();
+  expect('\n', "new line");
+  return l;
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::read_delta
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: 7-bit variable-length encoding of the binary AND section
+
+\*******************************************************************/
+
+aiger_parsert::literalt aiger_parsert::read_delta()
+{
+  literalt result = 0;
+  unsigned shift = 0;
+
+  while(true)
+  {
+    if(at_end())
+      error("unexpected end of file in binary AND section");
+
+    unsigned char ch = *(p++);
+
+    if(shift >= std::numeric_limits<literalt>::digits)
+      error("invalid delta encoding in binary AND section");
+
+    result |= literalt(ch & 0x7f) << shift;
+
+    if((ch & 0x80) == 0)
+      return result;
+
+    shift += 7;
+  }
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::parse_header
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parsert::parse_header(
+  std::size_t &I,
+  std::size_t &L,
+  std::size_t &O,
+  std::size_t &A,
+  std::size_t &B,
+  std::size_t &C,
+  std::size_t &J,
+  std::size_t &F)
+{
+  if(end - p >= 3 && std::string(p, 3) == "aag")
+    binary = false;
+  else if(end - p >= 3 && std::string(p, 3) == "aig")
+    binary = true;
+  else
+    error("expected AIGER header");
+
+  p += 3;
+
+  std::size_t *fields[] = {&dest.max_var, &I, &L, &O, &A, &B, &C, &J, &F};
+  std::size_t count = 0;
+
+  B = C = J = F = 0;
+
+  while(!at_end() && *p == ' ' && count < 9)
+  {
+    p++;
+    *fields[count++] = read_number();
+  }
+
+  if(count < 5)
+    error("AIGER header is incomplete");
+
+  expect('\n', "new line after header");
+
+  if(dest.max_var > std::numeric_limits<literalt>::max() / 2 - 1)
+    error("maximum variable index too large");
+
+  if(binary && dest.max_var != I + L + A)
+    error("binary AIGER requires M = I + L + A");
+
+  if(dest.max_var < I + L + A)
+    error("M is smaller than I + L + A");
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::parse_ands
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parsert::parse_ands(std::size_t A)
+{
+  dest.ands.resize(A);
+
+  if(binary)
+  {
+    // the AND gates come with consecutive, implicit output literals
+    literalt lhs = 2 * (dest.inputs.size() + dest.latches.size());
+
+    for(auto &a : dest.ands)
+    {
+      lhs += 2;
+      a.lhs = lhs;
+
+      auto delta0 = read_delta();
+      if(delta0 == 0 || delta0 > lhs)
+        error("invalid delta in binary AND section");
+      a.rhs0 = lhs - delta0;
+
+      auto delta1 = read_delta();
+      if(delta1 > a.rhs0)
+        error("invalid delta in binary AND section");
+      a.rhs1 = a.rhs0 - delta1;
+    }
+  }
+  else
+  {
+    for(auto &a : dest.ands)
+    {
+      a.lhs = read_literal();
+      if(a.lhs < 2 || (a.lhs & 1) != 0)
+        error("AND gate output must be a positive variable");
+      expect(' ', "space");
+      a.rhs0 = read_literal();
+      expect(' ', "space");
+      a.rhs1 = read_literal();
+      expect('\n', "new line");
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::parse_symbols
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parsert::parse_symbols()
+{
+  while(!at_end())
+  {
+    char kind = *(p++);
+
+    if(kind == 'c' && (at_end() || *p == '\n'))
+    {
+      // the remainder of the file is a comment
+      if(!at_end())
+        p++;
+      dest.comment.assign(p, end);
+      p = end;
+      return;
+    }
+
+    aiger_parse_treet::namest *names;
+    std::size_t size;
+
+    switch(kind)
+    {
+    case 'i':
+      names = &dest.input_names;
+      size = dest.inputs.size();
+      break;
+    case 'l':
+      names = &dest.latch_names;
+      size = dest.latches.size();
+      break;
+    case 'o':
+      names = &dest.output_names;
+      size = dest.outputs.size();
+      break;
+    case 'b':
+      names = &dest.bad_names;
+      size = dest.bad.size();
+      break;
+    case 'c':
+      names = &dest.constraint_names;
+      size = dest.constraints.size();
+      break;
+    case 'j':
+      names = &dest.justice_names;
+      size = dest.justice.size();
+      break;
+    case 'f':
+      names = &dest.fairness_names;
+      size = dest.fairness.size();
+      break;
+    default:
+      error("invalid symbol table entry");
+    }
+
+    auto position = read_number();
+    if(position >= size)
+      error("symbol table entry out of range");
+
+    expect(' ', "space");
+
+    const char *name_begin = p;
+    while(!at_end() && *p != '\n')
+      p++;
+
+    (*names)[position] = std::string(name_begin, p);
+
+    if(!at_end())
+      expect('\n', "new line");
+  }
+}
+
+/*******************************************************************\
+
+Function: aiger_parsert::parse
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parsert::parse()
+{
+  std::size_t I, L, O, A, B, C, J, F;
+
+  parse_header(I, L, O, A, B, C, J, F);
+
+  dest.inputs.resize(I);
+
+  for(std::size_t i = 0; i < I; i++)
+  {
+    if(binary)
+      dest.inputs[i] = 2 * (i + 1);
+    else
+    {
+      dest.inputs[i] = read_literal_line();
+      if(dest.inputs[i] < 2 || (dest.inputs[i] & 1) != 0)
+        error("input must be a positive variable");
+    }
+  }
+
+  dest.latches.resize(L);
+
+  for(std::size_t i = 0; i < L; i++)
+  {
+    auto &latch = dest.latches[i];
+
+    if(binary)
+      latch.lit = 2 * (I + i + 1);
+    else
+    {
+      latch.lit = read_literal();
+      if(latch.lit < 2 || (latch.lit & 1) != 0)
+        error("latch must be a positive variable");
+      expect(' ', "space");
+    }
+
+    latch.next = read_literal();
+
+    if(!at_end() && *p == ' ')
+    {
+      p++;
+      latch.reset = read_literal();
+      if(latch.reset != 0 && latch.reset != 1 && latch.reset != latch.lit)
+        error("latch reset must be 0, 1, or the latch literal");
+    }
+    else
+      latch.reset = 0;
+
+    expect('\n', "new line");
+  }
+
+  dest.outputs.resize(O);
+  for(auto &l : dest.outputs)
+    l = read_literal_line();
+
+  dest.bad.resize(B);
+  for(auto &l : dest.bad)
+    l = read_literal_line();
+
+  dest.constraints.resize(C);
+  for(auto &l : dest.constraints)
+    l = read_literal_line();
+
+  dest.justice.resize(J);
+  for(auto &j : dest.justice)
+  {
+    auto size = read_number();
+    expect('\n', "new line");
+    if(size == 0)
+      error("justice property must not be empty");
+    j.resize(size);
+  }
+
+  for(auto &j : dest.justice)
+    for(auto &l : j)
+      l = read_literal_line();
+
+  dest.fairness.resize(F);
+  for(auto &l : dest.fairness)
+    l = read_literal_line();
+
+  parse_ands(A);
+
+  parse_symbols();
+}
+
+/*******************************************************************\
+
+Function: aiger_parse
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_parse(const char *begin, const char *end, aiger_parse_treet &dest)
+{
+  dest.clear();
+  aiger_parsert(begin, end, dest).parse();
+}
@@ -0,0 +1,17 @@
+/*******************************************************************\
+
+Module: AIGER Parser
+
+\*******************************************************************/
+
+#ifndef CPROVER_AIGER_PARSER_H
+#define CPROVER_AIGER_PARSER_H
+
+#include "aiger_parse_tree.h"
+
+/// Parses an AIGER 1.9 file, in ASCII ("aag") or binary ("aig")
+/// format, given as the character range [begin, end).
+/// Throws a std::string on error.
+void aiger_parse(const char *begin, const char *end, aiger_parse_treet &);
+
+#endif // CPROVER_AIGER_PARSER_H
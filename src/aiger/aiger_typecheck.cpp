@@ -0,0 +1,348 @@
+/*******************************************************************\
+
+Module: AIGER Type Checking
+
+\*******************************************************************/
+
+#include "aiger_typecheck.h"
+
+#include <util/expr_util.h>
+#include <util/mathematical_expr.h>
+#include <util/std_expr.h>
+
+#include <temporal-logic/temporal_expr.h>
+
+/*******************************************************************\
+
+   Class: aiger_typecheckt
+
+ Purpose:
+
+\*******************************************************************/
+
+class aiger_typecheckt
+{
+public:
+  aiger_typecheckt(
+    const aiger_parse_treet &_parse_tree,
+    symbol_table_baset &_symbol_table,
+    const std::string &_module,
+    message_handlert &_message_handler)
+    : parse_tree(_parse_tree),
+      symbol_table(_symbol_table),
+      module(_module),
+      message(_message_handler)
+  {
+  }
+
+  void typecheck();
+
+protected:
+  using literalt = aiger_parse_treet::literalt;
+
+  const aiger_parse_treet &parse_tree;
+  symbol_table_baset &symbol_table;
+  const irep_idt module;
+  messaget message;
+
+  // the symbols for the AIGER variables, by variable number
+  std::vector<symbol_exprt> variables;
+
+  [[noreturn]] void error(const std::string &msg)
+  {
+    message.error() << msg << messaget::eom;
+    throw 0;
+  }
+
+  static std::string name(
+    const aiger_parse_treet::namest &names,
+    const std::string &prefix,
+    std::size_t position)
+  {
+    auto n_it = names.find(position);
+    if(n_it == names.end())
+      return prefix + std::to_string(position);
+    else
+      return n_it->second;
+  }
+
+  symbolt &new_symbol(const std::string &suffix, const std::string &base_name);
+  symbolt &
+  add_variable(literalt, const std::string &suffix, const std::string &);
+  void add_property(
+    const std::string &suffix,
+    const std::string &base_name,
+    exprt value);
+  exprt literal_expr(literalt) const;
+};
+
+/*******************************************************************\
+
+Function: aiger_typecheckt::new_symbol
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbolt &aiger_typecheckt::new_symbol(
+  const std::string &suffix,
+  const std::string &base_name)
+{
+  symbolt symbol{id2string(module) + "::" + suffix, bool_typet(), "AIGER"};
+  symbol.module = module;
+  symbol.base_name = base_name;
+  symbol.pretty_name = base_name;
+
+  symbolt *new_symbol;
+  if(symbol_table.move(symbol, new_symbol))
+    error("duplicate symbol `" + id2string(symbol.name) + '\'');
+
+  return *new_symbol;
+}
+
+/*******************************************************************\
+
+Function: aiger_typecheckt::add_variable
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbolt &aiger_typecheckt::add_variable(
+  literalt lit,
+  const std::string &suffix,
+  const std::string &base_name)
+{
+  auto var_no = lit >> 1;
+
+  if(variables[var_no].get_identifier() != irep_idt())
+    error("variable " + std::to_string(var_no) + " is defined twice");
+
+  auto &symbol = new_symbol(suffix, base_name);
+  variables[var_no] = symbol.symbol_expr();
+  return symbol;
+}
+
+/*******************************************************************\
+
+Function: aiger_typecheckt::add_property
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_typecheckt::add_property(
+  const std::string &suffix,
+  const std::string &base_name,
+  exprt value)
+{
+  auto &symbol = new_symbol(suffix, base_name);
+  symbol.is_property = true;
+  symbol.value = std::move(value);
+}
+
+/*******************************************************************\
+
+Function: aiger_typecheckt::literal_expr
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt aiger_typecheckt::literal_expr(literalt lit) const
+{
+  if(lit == 0)
+    return false_exprt();
+  else if(lit == 1)
+    return true_exprt();
+
+  auto &variable = variables[lit >> 1];
+
+  if(variable.get_identifier() == irep_idt())
+  {
+    message.error() << "literal " << lit << " is undefined" << messaget::eom;
+    throw 0;
+  }
+
+  if(lit & 1)
+    return not_exprt(variable);
+  else
+    return variable;
+}
+
+/*******************************************************************\
+
+Function: aiger_typecheckt::typecheck
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void aiger_typecheckt::typecheck()
+{
+  variables.resize(
+    parse_tree.max_var + 1, symbol_exprt(irep_idt(), bool_typet()));
+
+  // first declare all variables, as the AND gates of an ASCII file
+  // need not be in topological order
+  for(std::size_t i = 0; i < parse_tree.inputs.size(); i++)
+  {
+    auto &symbol = add_variable(
+      parse_tree.inputs[i],
+      "i" + std::to_string(i),
+      name(parse_tree.input_names, "i", i));
+    symbol.is_input = true;
+  }
+
+  for(std::size_t i = 0; i < parse_tree.latches.size(); i++)
+  {
+    auto &symbol = add_variable(
+      parse_tree.latches[i].lit,
+      "l" + std::to_string(i),
+      name(parse_tree.latch_names, "l", i));
+    symbol.is_state_var = true;
+  }
+
+  for(auto &a : parse_tree.ands)
+  {
+    auto base_name = "a" + std::to_string(a.lhs >> 1);
+    add_variable(a.lhs, base_name, base_name);
+  }
+
+  exprt::operandst invar, init, trans;
+
+  // AND gates are wires
+  invar.reserve(parse_tree.ands.size() + parse_tree.constraints.size());
+
+  for(auto &a : parse_tree.ands)
+  {
+    invar.push_back(equal_exprt(
+      literal_expr(a.lhs),
+      and_exprt(literal_expr(a.rhs0), literal_expr(a.rhs1))));
+  }
+
+  // the environment constraints hold in all states
+  for(auto c : parse_tree.constraints)
+    invar.push_back(literal_expr(c));
+
+  for(auto &latch : parse_tree.latches)
+  {
+    const auto &current = variables[latch.lit >> 1];
+
+    // an uninitialized latch has itself as reset value
+    if(latch.reset == 0)
+      init.push_back(not_exprt(current));
+    else if(latch.reset == 1)
+      init.push_back(current);
+
+    exprt next(ID_next_symbol, bool_typet());
+    next.set(ID_identifier, current.get_identifier());
+    trans.push_back(equal_exprt(next, literal_expr(latch.next)));
+  }
+
+  // the module
+  symbolt module_symbol{module, typet(ID_module), "AIGER"};
+  module_symbol.base_name = "main";
+  module_symbol.pretty_name = "main";
+  module_symbol.module = module;
+  module_symbol.value = transt{
+    ID_trans,
+    conjunction(invar),
+    conjunction(init),
+    conjunction(trans),
+    module_symbol.type};
+
+  if(symbol_table.add(module_symbol))
+    error("duplicate module `" + id2string(module) + '\'');
+
+  // bad-state properties; without those, the outputs are taken as
+  // bad-state properties, as in AIGER 1.0
+  for(std::size_t i = 0; i < parse_tree.bad.size(); i++)
+  {
+    add_property(
+      "b" + std::to_string(i),
+      name(parse_tree.bad_names, "b", i),
+      AG_exprt(boolean_negate(literal_expr(parse_tree.bad[i]))));
+  }
+
+  if(parse_tree.bad.empty() && parse_tree.justice.empty())
+  {
+    for(std::size_t i = 0; i < parse_tree.outputs.size(); i++)
+    {
+      add_property(
+        "o" + std::to_string(i),
+        name(parse_tree.output_names, "o", i),
+        AG_exprt(boolean_negate(literal_expr(parse_tree.outputs[i]))));
+    }
+  }
+
+  // A justice property fails if there is a path on which all its
+  // literals and all fairness constraints hold infinitely often.
+  exprt::operandst fair;
+
+  for(auto f : parse_tree.fairness)
+    fair.push_back(G_exprt(F_exprt(literal_expr(f))));
+
+  for(std::size_t i = 0; i < parse_tree.justice.size(); i++)
+  {
+    exprt::operandst conjuncts = fair;
+
+    for(auto l : parse_tree.justice[i])
+      conjuncts.push_back(G_exprt(F_exprt(literal_expr(l))));
+
+    add_property(
+      "j" + std::to_string(i),
+      name(parse_tree.justice_names, "j", i),
+      not_exprt(conjunction(conjuncts)));
+  }
+}
+
+/*******************************************************************\
+
+Function: aiger_typecheck
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool aiger_typecheck(
+  const aiger_parse_treet &parse_tree,
+  symbol_table_baset &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler)
+{
+  try
+  {
+    aiger_typecheckt(parse_tree, symbol_table, module, message_handler)
+      .typecheck();
+    return false;
+  }
+  catch(int)
+  {
+    return true;
+  }
+}
@@ -0,0 +1,27 @@
+/*******************************************************************\
+
+Module: AIGER Type Checking
+
+\*******************************************************************/
+
+#ifndef CPROVER_AIGER_TYPECHECK_H
+#define CPROVER_AIGER_TYPECHECK_H
+
+#include <util/message.h>
+#include <util/symbol_table_base.h>
+
+#include "aiger_parse_tree.h"
+
+/// Adds the AIG as module with the given name to the symbol table.
+/// Inputs and latches become variables, AND gates become wires,
+/// constraints become invariants, and bad-state and justice
+/// properties become properties of the module. This is the model
+/// of the word-level engines; the bit-level engines get the netlist
+/// from aiger_netlist.
+bool aiger_typecheck(
+  const aiger_parse_treet &,
+  symbol_table_baset &,
+  const std::string &module,
+  message_handlert &);
+
+#endif // CPROVER_AIGER_TYPECHECK_H
@@ -9,25 +9,26 @@ Author: Daniel Kroening, daniel.kroening@inf.ethz.ch
 #include "bdd_engine.h"
 
 #include <util/format_expr.h>
+#include <util/phase_statistics.h>
 
 #include <ebmc/ebmc_properties.h>
 #include <ebmc/transition_system.h>
 #include <solvers/bdd/miniBDD/miniBDD.h>
-#include <solvers/sat/satcheck.h>
 #include <temporal-logic/negate_property.h>
 #include <temporal-logic/temporal_expr.h>
 #include <temporal-logic/temporal_logic.h>
 #include <trans-netlist/aig_prop.h>
 #include <trans-netlist/instantiate_netlist.h>
-#include <trans-netlist/trans_to_netlist.h>
 #include <trans-netlist/trans_trace_netlist.h>
-#include <trans-netlist/unwind_netlist.h>
 #include <verilog/sva_expr.h>
 
 #include "report_results.h"
 
 #include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <set>
+#include <unordered_map>
 
 /*******************************************************************\
 
@@ -42,19 +43,24 @@ class bdd_enginet
 public:
   bdd_enginet(
     const cmdlinet &_cmdline,
-    ui_message_handlert &_ui_message_handler)
-    : cmdline(_cmdline), message(_ui_message_handler)
+    transition_systemt &_transition_system,
+    ebmc_propertiest &_properties,
+    message_handlert &_message_handler)
+    : cmdline(_cmdline),
+      transition_system(_transition_system),
+      properties(_properties),
+      message(_message_handler)
   {
   }
 
-  int operator()();
+  void operator()();
 
 protected:
   using propertyt = ebmc_propertiest::propertyt;
   const cmdlinet &cmdline;
+  transition_systemt &transition_system;
+  ebmc_propertiest &properties;
   messaget message;
-  transition_systemt transition_system;
-  ebmc_propertiest properties;
   netlistt netlist;
 
   // the Manager must appear before any BDDs
@@ -97,7 +103,46 @@ protected:
   varst vars;
   
   void allocate_vars(const var_mapt &);
+  void new_bdd_vars(const bv_varidt &, vart &);
   void build_BDDs();
+  void reorder_vars();
+
+  // The transition relation, partitioned into clusters, each
+  // with the 'next' and 'current' variables that no later cluster
+  // mentions. These are quantified right after conjoining the
+  // cluster, when computing pre-images and images, respectively.
+  struct clustert
+  {
+    BDD bdd;
+    std::vector<unsigned> quantify_next, quantify_current;
+  };
+
+  std::vector<clustert> clusters;
+
+  // the variables that no cluster mentions
+  std::vector<unsigned> quantify_next_first, quantify_current_first;
+
+  // limit on the number of BDD nodes of a cluster
+  static constexpr std::size_t cluster_size_limit = 5000;
+
+  // limit on the number of rounds of the reordering heuristic
+  static constexpr std::size_t reorder_rounds = 20;
+
+  // the largest number of BDD nodes seen so far
+  std::size_t peak_bdd_nodes = 0;
+
+  void update_peak_bdd_nodes()
+  {
+    peak_bdd_nodes = std::max(peak_bdd_nodes, mgr.number_of_nodes());
+  }
+
+  void build_clusters();
+  BDD pre_image(const BDD &) const;
+  BDD image(const BDD &) const;
+  static std::size_t bdd_size(const BDD &);
+  static std::size_t bdd_size(const std::vector<const BDD *> &);
+  std::vector<const BDD *> root_BDDs() const;
+  static void bdd_support(const BDD &, std::set<unsigned> &);
   
   inline BDD aig2bdd(
     literalt l,
@@ -120,11 +165,16 @@ protected:
   BDD project_next(const BDD &) const;
   BDD project_current(const BDD &) const;
 
-  void compute_counterexample(
-    propertyt &,
-    unsigned number_of_timeframes);
+  BDD pick_state(const BDD &) const;
+  std::vector<BDD> path_forward(const std::vector<BDD> &) const;
+  std::vector<BDD> path_backward(const std::vector<BDD> &) const;
+  void compute_counterexample(propertyt &, const std::vector<BDD> &path);
 
   void check_AGp(propertyt &);
+
+  // the states first reached in step 0, 1, 2, ...
+  std::vector<BDD> onion_rings;
+  void forward_reachability();
   void check_CTL(propertyt &);
   BDD CTL(const exprt &);
   BDD EX(BDD);
@@ -167,81 +217,78 @@ Function: bdd_enginet::operator()
 
 \*******************************************************************/
 
-int bdd_enginet::operator()()
+void bdd_enginet::operator()()
 {
-  try
-  {
-    transition_system =
-      get_transition_system(cmdline, message.get_message_handler());
+  message.status() << "Building netlist" << messaget::eom;
 
-    message.status() << "Building netlist" << messaget::eom;
+  {
+    phase_timert timer("netlist");
 
-    convert_trans_to_netlist(
-      transition_system.symbol_table,
-      transition_system.main_symbol->name,
-      netlist,
-      message.get_message_handler());
+    convert_to_netlist(
+      transition_system, netlist, message.get_message_handler());
+  }
 
-    message.statistics() << "Latches: " << netlist.var_map.latches.size()
-                         << ", nodes: " << netlist.number_of_nodes()
-                         << messaget::eom;
+  message.statistics() << "Latches: " << netlist.var_map.latches.size()
+                       << ", nodes: " << netlist.number_of_nodes()
+                       << messaget::eom;
 
-    properties = ebmc_propertiest::from_command_line(
-      cmdline, transition_system, message.get_message_handler());
+  output_strash_statistics(netlist, message);
 
+  {
+    phase_timert timer("properties");
     for(const propertyt &p : properties.properties)
       get_atomic_propositions(p.normalized_expr);
+  }
 
-    message.status() << "Building BDD for netlist" << messaget::eom;
+  message.status() << "Building BDD for netlist" << messaget::eom;
 
+  {
+    phase_timert timer("bdd");
     allocate_vars(netlist.var_map);
     build_BDDs();
 
-    message.statistics() << "BDD nodes: " << mgr.number_of_nodes()
-                         << messaget::eom;
+    if(cmdline.isset("bdd-reorder"))
+      reorder_vars();
 
-    if(cmdline.isset("show-bdds"))
-    {
-      mgr.DumpTable(std::cout);
-      std::cout << '\n';
-      
-      std::cout << "Atomic propositions:\n";
-      for(const auto & a : atomic_propositions)
-      {
-        std::cout << '`' << format(a.first) << "' -> "
-                  << a.second.bdd.node_number() << '\n';
-      }
+    build_clusters();
+  }
 
-      std::cout << '\n';
-        
-      return 0;
-    }
+  message.statistics() << "BDD nodes: " << mgr.number_of_nodes()
+                       << messaget::eom;
+
+  if(cmdline.isset("show-bdds"))
+  {
+    mgr.DumpTable(std::cout);
+    std::cout << '\n';
 
-    if(properties.properties.empty())
+    std::cout << "Atomic propositions:\n";
+    for(const auto &a : atomic_propositions)
     {
-      message.error() << "no properties" << messaget::eom;
-      return 1;
+      std::cout << '`' << format(a.first) << "' -> "
+                << a.second.bdd.node_number() << '\n';
     }
 
-    for(propertyt &p : properties.properties)
-      check_property(p);
-
-    const namespacet ns(transition_system.symbol_table);
-    report_results(cmdline, properties, ns, message.get_message_handler());
+    std::cout << '\n';
 
-    // We return '0' if all properties are proven,
-    // and '10' otherwise.
-    return properties.all_properties_proved() ? 0 : 10;
-  }
-  catch(const char *error_msg)
-  {
-    message.error() << error_msg << messaget::eom;
-    return 1;
+    return;
   }
-  catch(int)
+
   {
-    return 1;
+    // image computation and fixpoints
+    phase_timert timer("solve");
+
+    // one forward traversal answers all AG p properties
+    if(cmdline.isset("bdd-forward"))
+      forward_reachability();
+
+    for(propertyt &p : properties.properties)
+      check_property(p);
   }
+
+  update_peak_bdd_nodes();
+
+  message.statistics() << "Peak BDD nodes: " << peak_bdd_nodes
+                       << messaget::eom;
 }
 
 /*******************************************************************\
@@ -258,7 +305,16 @@ Function: bdd_enginet::allocate_vars
 
 void bdd_enginet::allocate_vars(const var_mapt &var_map)
 {
-  // gather variables according to variable ordering
+  // the variables, by the number of their netlist node
+  struct var_nodet
+  {
+    bv_varidt bv_varid;
+    bool is_latch;
+    literalt next;
+  };
+
+  std::unordered_map<std::size_t, var_nodet> var_nodes;
+
   for(auto &it : var_map.map)
   {
     if(it.second.is_latch() ||
@@ -272,16 +328,279 @@ void bdd_enginet::allocate_vars(const var_mapt &var_map)
         bv_varidt bv_varid(it.first, bit_nr);
         vars[bv_varid].is_input=
           it.second.is_input() || it.second.is_nondet();
+
+        const auto &bit = it.second.bits[bit_nr];
+        var_nodes.emplace(
+          bit.current.var_no(),
+          var_nodet{bv_varid, it.second.is_latch(), bit.next});
       }
     }
   }
-  
-  // now allocate BBD variables
+
+  // The variables are allocated in the order in which they are
+  // found by a depth-first search over the fanin of the atomic
+  // propositions and the constraints, continued with the next-state
+  // functions of the latches found on the way. Variables that share
+  // logic thus end up close to each other. The 'next' variable
+  // immediately follows the 'current' variable.
+  std::vector<literalt> roots;
+
+  for(const auto &a : atomic_propositions)
+    roots.push_back(a.second.l);
+
+  roots.insert(
+    roots.end(), netlist.constraints.begin(), netlist.constraints.end());
+  roots.insert(roots.end(), netlist.initial.begin(), netlist.initial.end());
+
+  std::vector<bool> visited(netlist.nodes.size(), false);
+
+  auto allocate = [this](const bv_varidt &bv_varid) {
+    new_bdd_vars(bv_varid, vars[bv_varid]);
+  };
+
+  // the roots vector grows with the next-state functions
+  for(std::size_t root_nr = 0; root_nr < roots.size(); root_nr++)
+  {
+    if(roots[root_nr].is_constant())
+      continue;
+
+    std::vector<std::size_t> stack{roots[root_nr].var_no()};
+
+    while(!stack.empty())
+    {
+      std::size_t n = stack.back();
+      stack.pop_back();
+
+      if(visited[n])
+        continue;
+
+      visited[n] = true;
+
+      const auto &node = netlist.nodes[n];
+
+      if(node.is_and())
+      {
+        // visit 'a' first
+        if(!node.b.is_constant())
+          stack.push_back(node.b.var_no());
+        if(!node.a.is_constant())
+          stack.push_back(node.a.var_no());
+      }
+      else
+      {
+        auto v_it = var_nodes.find(n);
+        if(v_it == var_nodes.end())
+          continue;
+
+        allocate(v_it->second.bv_varid);
+
+        if(v_it->second.is_latch)
+          roots.push_back(v_it->second.next);
+      }
+    }
+  }
+
+  // the variables that nothing depends on, in the default order
   for(auto &it : vars)
   {
-    std::string s=it.first.as_string();
-    it.second.current=mgr.Var(s);
-    it.second.next=mgr.Var(s+"'");
+    if(!it.second.current.is_initialized())
+      allocate(it.first);
+  }
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::new_bdd_vars
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: allocate the 'current' and the 'next' BDD variable,
+          in this order, at the end of the variable order
+
+\*******************************************************************/
+
+void bdd_enginet::new_bdd_vars(const bv_varidt &bv_varid, vart &var)
+{
+  std::string s=bv_varid.as_string();
+  var.current=mgr.Var(s);
+  var.next=mgr.Var(s+"'");
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::reorder_vars
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Static variable reordering. The manager cannot swap
+          variables, so the BDDs are rebuilt with fresh variables
+          in the new order, and whichever order gives fewer nodes
+          is kept.
+
+          The order is computed by the FORCE heuristic (Aloul,
+          Markov, Sakallah, GLSVLSI 2003) over the supports of the
+          BDDs built from the netlist: in every round, each
+          variable moves to the average centre of gravity of the
+          supports it is in. The 'next' variable stays right after
+          the 'current' variable.
+
+\*******************************************************************/
+
+void bdd_enginet::reorder_vars()
+{
+  // the variables, in the present order
+  std::vector<varst::iterator> order;
+
+  for(auto it = vars.begin(); it != vars.end(); it++)
+    order.push_back(it);
+
+  std::sort(
+    order.begin(),
+    order.end(),
+    [](const varst::iterator &a, const varst::iterator &b) {
+      return a->second.current.var() < b->second.current.var();
+    });
+
+  std::map<unsigned, std::size_t> index_of_var;
+
+  for(std::size_t i = 0; i < order.size(); i++)
+  {
+    index_of_var[order[i]->second.current.var()] = i;
+    index_of_var[order[i]->second.next.var()] = i;
+  }
+
+  // the supports, as sets of indices into 'order'
+  std::vector<std::vector<std::size_t>> supports;
+
+  for(const BDD *bdd : root_BDDs())
+  {
+    std::set<unsigned> support;
+    bdd_support(*bdd, support);
+
+    std::set<std::size_t> indices;
+    for(auto v : support)
+    {
+      auto it = index_of_var.find(v);
+      if(it != index_of_var.end())
+        indices.insert(it->second);
+    }
+
+    if(indices.size() >= 2)
+      supports.emplace_back(indices.begin(), indices.end());
+  }
+
+  // the total span of the supports, which FORCE minimises
+  auto total_span = [&supports](const std::vector<std::size_t> &position) {
+    std::size_t result = 0;
+    for(const auto &support : supports)
+    {
+      auto minmax = std::minmax_element(
+        support.begin(),
+        support.end(),
+        [&position](std::size_t a, std::size_t b) {
+          return position[a] < position[b];
+        });
+      result += position[*minmax.second] - position[*minmax.first];
+    }
+    return result;
+  };
+
+  std::vector<std::size_t> position(order.size());
+  std::iota(position.begin(), position.end(), 0);
+
+  std::vector<std::size_t> best_position = position;
+  std::size_t best_span = total_span(position);
+
+  for(std::size_t round = 0; round < reorder_rounds; round++)
+  {
+    std::vector<double> sum(order.size(), 0.0);
+    std::vector<std::size_t> count(order.size(), 0);
+
+    for(const auto &support : supports)
+    {
+      double centre = 0;
+      for(auto i : support)
+        centre += position[i];
+      centre /= support.size();
+
+      for(auto i : support)
+      {
+        sum[i] += centre;
+        count[i]++;
+      }
+    }
+
+    std::vector<double> target(order.size());
+    for(std::size_t i = 0; i < order.size(); i++)
+      target[i] = count[i] == 0 ? position[i] : sum[i] / count[i];
+
+    std::vector<std::size_t> by_target(order.size());
+    std::iota(by_target.begin(), by_target.end(), 0);
+    std::stable_sort(
+      by_target.begin(),
+      by_target.end(),
+      [&target](std::size_t a, std::size_t b) {
+        return target[a] < target[b];
+      });
+
+    for(std::size_t p = 0; p < by_target.size(); p++)
+      position[by_target[p]] = p;
+
+    std::size_t span = total_span(position);
+
+    if(span >= best_span)
+      break;
+
+    best_span = span;
+    best_position = position;
+  }
+
+  // the variables, in the new order
+  std::vector<varst::iterator> new_order(order.size());
+  for(std::size_t i = 0; i < order.size(); i++)
+    new_order[best_position[i]] = order[i];
+
+  if(new_order == order)
+  {
+    message.statistics() << "BDD variable reordering: order unchanged"
+                         << messaget::eom;
+    return;
+  }
+
+  std::size_t nodes_before = bdd_size(root_BDDs());
+
+  // Keep the BDDs in the present order, in case the new order
+  // turns out to be worse.
+  varst saved_vars = vars;
+  atomic_propositionst saved_atomic_propositions = atomic_propositions;
+  std::vector<BDD> saved_constraints_BDDs, saved_initial_BDDs,
+    saved_transition_BDDs;
+  saved_constraints_BDDs.swap(constraints_BDDs);
+  saved_initial_BDDs.swap(initial_BDDs);
+  saved_transition_BDDs.swap(transition_BDDs);
+
+  for(const auto &it : new_order)
+    new_bdd_vars(it->first, it->second);
+
+  build_BDDs();
+
+  std::size_t nodes_after = bdd_size(root_BDDs());
+
+  message.statistics() << "BDD variable reordering: " << nodes_before
+                       << " nodes before, " << nodes_after << " after"
+                       << messaget::eom;
+
+  if(nodes_after >= nodes_before)
+  {
+    vars.swap(saved_vars);
+    atomic_propositions.swap(saved_atomic_propositions);
+    constraints_BDDs.swap(saved_constraints_BDDs);
+    initial_BDDs.swap(saved_initial_BDDs);
+    transition_BDDs.swap(saved_transition_BDDs);
   }
 }
 
@@ -301,138 +620,500 @@ bdd_enginet::BDD bdd_enginet::current_to_next(const BDD &bdd) const
 {
   BDD tmp=bdd;
 
-  for(const auto &v : vars)
-    tmp=substitute(tmp, v.second.current.var(), v.second.next);
+  for(const auto &v : vars)
+    tmp=substitute(tmp, v.second.current.var(), v.second.next);
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::next_to_current
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bdd_enginet::BDD bdd_enginet::next_to_current(const BDD &bdd) const
+{
+  BDD tmp=bdd;
+
+  for(const auto &v : vars)
+    tmp=substitute(tmp, v.second.next.var(), v.second.current);
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::project_next
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bdd_enginet::BDD bdd_enginet::project_next(const BDD &bdd) const
+{
+  BDD tmp=bdd;
+
+  for(const auto &v : vars)
+    tmp=exists(tmp, v.second.next.var());
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::project_current
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bdd_enginet::BDD bdd_enginet::project_current(const BDD &bdd) const
+{
+  BDD tmp=bdd;
+
+  for(const auto &v : vars)
+    tmp=exists(tmp, v.second.current.var());
+
+  return tmp;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::bdd_size
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: number of nodes of a BDD
+
+\*******************************************************************/
+
+std::size_t bdd_enginet::bdd_size(const BDD &bdd)
+{
+  return bdd_size(std::vector<const BDD *>{&bdd});
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::bdd_size
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: number of nodes of a set of BDDs, counting shared
+          nodes once
+
+\*******************************************************************/
+
+std::size_t bdd_enginet::bdd_size(const std::vector<const BDD *> &roots)
+{
+  std::set<unsigned> seen;
+  std::vector<const BDD *> stack = roots;
+
+  while(!stack.empty())
+  {
+    const BDD &b = *stack.back();
+    stack.pop_back();
+
+    if(b.is_constant() || !seen.insert(b.node_number()).second)
+      continue;
+
+    stack.push_back(&b.low());
+    stack.push_back(&b.high());
+  }
+
+  return seen.size();
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::root_BDDs
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the BDDs built from the netlist
+
+\*******************************************************************/
+
+std::vector<const bdd_enginet::BDD *> bdd_enginet::root_BDDs() const
+{
+  std::vector<const BDD *> result;
+
+  for(const auto &b : transition_BDDs)
+    result.push_back(&b);
+
+  for(const auto &b : constraints_BDDs)
+    result.push_back(&b);
+
+  for(const auto &b : initial_BDDs)
+    result.push_back(&b);
+
+  for(const auto &a : atomic_propositions)
+    result.push_back(&a.second.bdd);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::bdd_support
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the variables a BDD depends on
+
+\*******************************************************************/
+
+void bdd_enginet::bdd_support(const BDD &bdd, std::set<unsigned> &dest)
+{
+  std::set<unsigned> seen;
+  std::vector<const BDD *> stack{&bdd};
+
+  while(!stack.empty())
+  {
+    const BDD &b = *stack.back();
+    stack.pop_back();
+
+    if(b.is_constant() || !seen.insert(b.node_number()).second)
+      continue;
+
+    dest.insert(b.var());
+    stack.push_back(&b.low());
+    stack.push_back(&b.high());
+  }
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::build_clusters
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Conjoin the transition partitions into clusters of
+          bounded size, and schedule the quantification of each
+          'next' variable right after the last cluster that
+          mentions it.
+
+\*******************************************************************/
+
+void bdd_enginet::build_clusters()
+{
+  clusters.clear();
+  quantify_next_first.clear();
+  quantify_current_first.clear();
+
+  for(const auto &t : transition_BDDs)
+  {
+    if(!clusters.empty())
+    {
+      BDD merged = clusters.back().bdd & t;
+      if(bdd_size(merged) <= cluster_size_limit)
+      {
+        clusters.back().bdd = merged;
+        continue;
+      }
+    }
+
+    clusters.push_back(clustert{t, {}});
+  }
+
+  // the last cluster that mentions each variable
+  std::map<unsigned, std::size_t> last_cluster;
+
+  for(std::size_t i = 0; i < clusters.size(); i++)
+  {
+    std::set<unsigned> support;
+    bdd_support(clusters[i].bdd, support);
+    for(auto v : support)
+      last_cluster[v] = i;
+  }
+
+  for(const auto &v : vars)
+  {
+    unsigned next = v.second.next.var();
+    auto next_it = last_cluster.find(next);
+    if(next_it == last_cluster.end())
+      quantify_next_first.push_back(next);
+    else
+      clusters[next_it->second].quantify_next.push_back(next);
+
+    unsigned current = v.second.current.var();
+    auto current_it = last_cluster.find(current);
+    if(current_it == last_cluster.end())
+      quantify_current_first.push_back(current);
+    else
+      clusters[current_it->second].quantify_current.push_back(current);
+  }
+
+  message.statistics() << "Transition relation: " << transition_BDDs.size()
+                       << " partitions in " << clusters.size() << " clusters"
+                       << messaget::eom;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::pre_image
+
+  Inputs: a set of states
+
+ Outputs: the set of states that have a successor in the given set
+
+ Purpose: relational product with early quantification
+
+\*******************************************************************/
+
+bdd_enginet::BDD bdd_enginet::pre_image(const BDD &states) const
+{
+  // make the states be expressed in terms of 'next' variables
+  BDD result = current_to_next(states);
+
+  for(auto v : quantify_next_first)
+    result = exists(result, v);
+
+  // conjoin the clusters, and project away the 'next' variables
+  // as soon as no remaining cluster depends on them
+  for(const auto &cluster : clusters)
+  {
+    result = result & cluster.bdd;
+
+    for(auto v : cluster.quantify_next)
+      result = exists(result, v);
+  }
+
+  for(const auto &c : constraints_BDDs)
+    result = result & c;
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::image
+
+  Inputs: a set of states
+
+ Outputs: the set of successors of the given states
+
+ Purpose: relational product with early quantification
+
+\*******************************************************************/
+
+bdd_enginet::BDD bdd_enginet::image(const BDD &states) const
+{
+  BDD result = states;
+
+  for(const auto &c : constraints_BDDs)
+    result = result & c;
+
+  for(auto v : quantify_current_first)
+    result = exists(result, v);
 
-  return tmp;
+  // conjoin the clusters, and project away the 'current' variables
+  // as soon as no remaining cluster depends on them
+  for(const auto &cluster : clusters)
+  {
+    result = result & cluster.bdd;
+
+    for(auto v : cluster.quantify_current)
+      result = exists(result, v);
+  }
+
+  // make the states be expressed in terms of 'current' variables
+  return next_to_current(result);
 }
 
 /*******************************************************************\
 
-Function: bdd_enginet::next_to_current
+Function: bdd_enginet::pick_state
 
-  Inputs:
+  Inputs: a non-empty set of states
 
- Outputs:
+ Outputs: a single state in the set, as a cube over all
+          'current' variables
 
  Purpose:
 
 \*******************************************************************/
 
-bdd_enginet::BDD bdd_enginet::next_to_current(const BDD &bdd) const
+bdd_enginet::BDD bdd_enginet::pick_state(const BDD &states) const
 {
-  BDD tmp=bdd;
+  PRECONDITION(!states.is_false());
+
+  // follow any path to 'true'
+  std::map<unsigned, bool> assignment;
+  BDD node = states;
+
+  while(!node.is_constant())
+  {
+    bool value = node.low().is_false();
+    assignment[node.var()] = value;
+    BDD child = value ? node.high() : node.low();
+    node = child;
+  }
+
+  // the variables not on the path are set to false
+  BDD result = mgr.True();
 
   for(const auto &v : vars)
-    tmp=substitute(tmp, v.second.next.var(), v.second.current);
+  {
+    auto a_it = assignment.find(v.second.current.var());
+    if(a_it != assignment.end() && a_it->second)
+      result = result & v.second.current;
+    else
+      result = result & !v.second.current;
+  }
 
-  return tmp;
+  return result;
 }
 
 /*******************************************************************\
 
-Function: bdd_enginet::project_next
+Function: bdd_enginet::path_forward
 
-  Inputs:
+  Inputs: sets of states S_0, ..., S_k, where each state in S_i
+          has a successor in S_i+1
 
- Outputs:
+ Outputs: a path of single states s_0, ..., s_k with s_i in S_i
 
- Purpose:
+ Purpose: walks images forward from S_0
 
 \*******************************************************************/
 
-bdd_enginet::BDD bdd_enginet::project_next(const BDD &bdd) const
+std::vector<bdd_enginet::BDD>
+bdd_enginet::path_forward(const std::vector<BDD> &sets) const
 {
-  BDD tmp=bdd;
+  PRECONDITION(!sets.empty());
 
-  for(const auto &v : vars)
-    tmp=exists(tmp, v.second.next.var());
+  std::vector<BDD> path;
+  path.reserve(sets.size());
+  path.push_back(pick_state(sets.front()));
 
-  return tmp;
+  for(std::size_t i = 1; i < sets.size(); i++)
+    path.push_back(pick_state(image(path.back()) & sets[i]));
+
+  return path;
 }
 
 /*******************************************************************\
 
-Function: bdd_enginet::project_current
+Function: bdd_enginet::path_backward
 
-  Inputs:
+  Inputs: sets of states S_0, ..., S_k, where each state in S_i+1
+          has a predecessor in S_i
 
- Outputs:
+ Outputs: a path of single states s_0, ..., s_k with s_i in S_i
 
- Purpose:
+ Purpose: walks pre-images backward from S_k
 
 \*******************************************************************/
 
-bdd_enginet::BDD bdd_enginet::project_current(const BDD &bdd) const
+std::vector<bdd_enginet::BDD>
+bdd_enginet::path_backward(const std::vector<BDD> &sets) const
 {
-  BDD tmp=bdd;
+  PRECONDITION(!sets.empty());
 
-  for(const auto &v : vars)
-    tmp=exists(tmp, v.second.current.var());
+  std::vector<BDD> path(sets.size());
+  path.back() = pick_state(sets.back());
 
-  return tmp;
+  for(std::size_t i = sets.size() - 1; i != 0; i--)
+    path[i - 1] = pick_state(pre_image(path[i]) & sets[i - 1]);
+
+  return path;
 }
 
 /*******************************************************************\
 
 Function: bdd_enginet::compute_counterexample
 
-  Inputs:
+  Inputs: a path of single states
 
  Outputs:
 
- Purpose:
+ Purpose: turns the path into a trace by simulating the netlist
 
 \*******************************************************************/
 
 void bdd_enginet::compute_counterexample(
   propertyt &property,
-  unsigned number_of_timeframes)
+  const std::vector<BDD> &path)
 {
-  // Supported by BMC engine?
-  if(!netlist_bmc_supports_property(property.normalized_expr))
-    return;
-
-  message.status() << "Computing counterexample with " << number_of_timeframes
+  message.status() << "Computing counterexample with " << path.size()
                    << " timeframe(s)" << messaget::eom;
 
-  bmc_mapt bmc_map;
-
-  satcheckt solver{message.get_message_handler()};
-  bmc_map.map_timeframes(netlist, number_of_timeframes, solver);
-
-  ::unwind(netlist, bmc_map, message, solver);
-
   // find the netlist property
   auto netlist_property = netlist.properties.find(property.identifier);
   CHECK_RETURN(netlist_property != netlist.properties.end());
+  PRECONDITION(std::holds_alternative<netlistt::Gpt>(netlist_property->second));
 
-  ::unwind_property(
-    netlist_property->second, bmc_map, property.timeframe_literals);
+  std::vector<std::vector<bool>> var_values;
+  var_values.reserve(path.size());
 
-  // we need the propertyt to fail in one of the timeframes
-  bvt clause=property.timeframe_literals;
-  for(auto & l : clause) l=!l;
-  solver.lcnf(clause);
-  
-  propt::resultt prop_result=
-    solver.prop_solve();
-
-  switch(prop_result)
+  for(const auto &state : path)
   {
-  case propt::resultt::P_SATISFIABLE: break; // this is what we want
-  
-  case propt::resultt::P_UNSATISFIABLE:
-    throw "SAT solver says UNSAT!";
-  case propt::resultt::P_ERROR:
-  default:
-    throw "unexpected result from SAT solver";
+    std::vector<bool> values(netlist.nodes.size(), false);
+
+    for(std::size_t n = 0; n < netlist.nodes.size(); n++)
+    {
+      if(netlist.nodes[n].is_and())
+        continue;
+
+      auto v_it = vars.find(netlist.var_map.reverse(n));
+      if(v_it != vars.end())
+        values[n] = !(state & v_it->second.current).is_false();
+    }
+
+    var_values.push_back(std::move(values));
   }
 
   const namespacet ns(transition_system.symbol_table);
 
-  property.witness_trace =
-    compute_trans_trace(property.timeframe_literals, bmc_map, solver, ns);
+  property.witness_trace = compute_trans_trace(
+    std::get<netlistt::Gpt>(netlist_property->second).p,
+    netlist,
+    var_values,
+    ns);
+}
+
+/*******************************************************************\
+
+Function: is_AGp
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: AG p, G p, or always p, with p free of temporal operators
+
+\*******************************************************************/
+
+static bool is_AGp(const exprt &expr)
+{
+  return (expr.id() == ID_AG || expr.id() == ID_G ||
+          expr.id() == ID_sva_always) &&
+         !has_temporal_operator(to_unary_expr(expr).op());
 }
 
 /*******************************************************************\
@@ -452,19 +1133,19 @@ void bdd_enginet::check_property(propertyt &property)
   if(property.is_disabled())
     return;
 
-  if(property.is_assumed())
+  if(property.is_assumed() || property.is_failure())
+    return;
+
+  // another engine may have settled the property meanwhile
+  properties.update(property);
+
+  // already decided by forward reachability?
+  if(property.is_proved() || property.is_refuted())
     return;
 
   message.status() << "Checking " << property.name << messaget::eom;
   property.status=propertyt::statust::UNKNOWN;
 
-  // special treatment for AGp
-  auto is_AGp = [](const exprt &expr) {
-    return (expr.id() == ID_AG || expr.id() == ID_G ||
-            expr.id() == ID_sva_always) &&
-           !has_temporal_operator(to_unary_expr(expr).op());
-  };
-
   // Our engine knows CTL only.
   // We map selected path properties to CTL.
 
@@ -494,6 +1175,7 @@ void bdd_enginet::check_property(propertyt &property)
     property.normalized_expr = AG_exprt{AF_exprt{p}};
   }
 
+  // special treatment for AGp
   if(is_AGp(property.normalized_expr))
   {
     check_AGp(property);
@@ -524,7 +1206,8 @@ void bdd_enginet::check_AGp(propertyt &property)
   BDD p = CTL(sub_expr);
 
   // Start with !p, and go backwards until saturation or we hit an
-  // initial state.
+  // initial state. Only the states that are new in an iteration
+  // (the frontier) need to be checked and imaged.
 
   BDD states = !p;
   unsigned iteration = 0;
@@ -532,58 +1215,189 @@ void bdd_enginet::check_AGp(propertyt &property)
   for(const auto &c : constraints_BDDs)
     states = states & c;
 
-  std::size_t peak_bdd_nodes = 0;
+  BDD frontier = states;
+
+  // the frontiers, for computing a counterexample
+  std::vector<BDD> rings;
 
   while(true)
   {
     iteration++;
     message.statistics() << "Iteration " << iteration << messaget::eom;
 
+    rings.push_back(frontier);
+
     // do we have an initial state?
-    BDD intersection = states;
+    BDD intersection = frontier;
 
     for(const auto &i : initial_BDDs)
       intersection = intersection & i;
 
-    peak_bdd_nodes = std::max(peak_bdd_nodes, mgr.number_of_nodes());
+    update_peak_bdd_nodes();
 
     if(!intersection.is_false())
     {
       property.refuted();
+      properties.settled(property);
       message.status() << "Property refuted" << messaget::eom;
-      compute_counterexample(property, iteration);
+
+      // The states in ring i+1 have a successor in ring i.
+      // Walk forward from the initial state we have found.
+      std::reverse(rings.begin(), rings.end());
+      rings.front() = intersection;
+
+      phase_timert timer("trace");
+      compute_counterexample(property, path_forward(rings));
+      break;
+    }
+
+    // the predecessors we haven't seen yet
+    frontier = pre_image(frontier) & !states;
+
+    // have we saturated?
+    if(frontier.is_false())
+    {
+      property.proved();
+      properties.settled(property);
+      message.status() << "Property proved" << messaget::eom;
       break;
     }
 
-    // make the states be expressed in terms of 'next' variables
-    BDD states_next = current_to_next(states);
+    states = states | frontier;
+
+    // another engine may have settled the property meanwhile
+    properties.update(property);
+    if(property.is_proved() || property.is_refuted())
+      break;
+
+    update_peak_bdd_nodes();
+  }
+}
+
+/*******************************************************************\
+
+Function: bdd_enginet::forward_reachability
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Computes the reachable states by breadth-first search
+          from the initial states, and checks all AG p properties
+          on the way. The onion rings are the sets of states first
+          reached at the given depth.
+
+\*******************************************************************/
+
+void bdd_enginet::forward_reachability()
+{
+  // the AG p properties, with the states that violate them
+  std::vector<std::pair<propertyt *, BDD>> open;
+
+  for(auto &property : properties.properties)
+  {
+    if(
+      property.is_disabled() || property.is_assumed() ||
+      property.is_failure())
+    {
+      continue;
+    }
 
-    // now conjoin with transition relation
-    BDD conjunction = states_next;
+    if(!is_AGp(property.normalized_expr))
+      continue;
 
-    for(const auto &t : transition_BDDs)
-      conjunction = conjunction & t;
+    BDD bad = !CTL(to_unary_expr(property.normalized_expr).op());
 
     for(const auto &c : constraints_BDDs)
-      conjunction = conjunction & c;
+      bad = bad & c;
 
-    // now project away 'next' variables
-    BDD pre_image = project_next(conjunction);
+    property.status = propertyt::statust::UNKNOWN;
+    open.emplace_back(&property, bad);
+  }
+
+  if(open.empty())
+    return;
 
-    // compute union
-    BDD set_union = states | pre_image;
+  message.status() << "Forward reachability for " << open.size()
+                   << " propert" << (open.size() == 1 ? "y" : "ies")
+                   << messaget::eom;
 
-    // have we saturated?
-    if((set_union == states).is_true())
+  BDD reachable = mgr.True();
+
+  for(const auto &i : initial_BDDs)
+    reachable = reachable & i;
+
+  BDD frontier = reachable;
+  onion_rings.clear();
+
+  while(true)
+  {
+    onion_rings.push_back(frontier);
+    message.statistics() << "Iteration " << onion_rings.size()
+                         << messaget::eom;
+
+    // check the properties on the states that are new
+    for(auto it = open.begin(); it != open.end();)
     {
-      property.proved();
-      message.status() << "Property proved" << messaget::eom;
+      // another engine may have settled the property meanwhile
+      properties.update(*it->first);
+      if(it->first->is_proved() || it->first->is_refuted())
+      {
+        it = open.erase(it);
+        continue;
+      }
+
+      if((frontier & it->second).is_false())
+      {
+        it++;
+        continue;
+      }
+
+      propertyt &property = *it->first;
+      property.refuted();
+      properties.settled(property);
+      message.status() << "Property " << property.name << " refuted"
+                       << messaget::eom;
+
+      // The states in ring i+1 have a predecessor in ring i.
+      // Walk backward from the state violating the property.
+      std::vector<BDD> rings = onion_rings;
+      rings.back() = frontier & it->second;
+
+      {
+        phase_timert timer("trace");
+        compute_counterexample(property, path_backward(rings));
+      }
+
+      it = open.erase(it);
+    }
+
+    if(open.empty())
+      break;
+
+    update_peak_bdd_nodes();
+
+    // the successors we haven't seen yet
+    frontier = image(frontier) & !reachable;
+
+    if(frontier.is_false())
+    {
+      // saturated -- the remaining properties hold
+      for(auto &o : open)
+      {
+        o.first->proved();
+        properties.settled(*o.first);
+      }
+
+      message.status() << "Reachable states saturated after "
+                       << onion_rings.size() << " iterations"
+                       << messaget::eom;
       break;
     }
 
-    states = set_union;
+    reachable = reachable | frontier;
 
-    peak_bdd_nodes = std::max(peak_bdd_nodes, mgr.number_of_nodes());
+    update_peak_bdd_nodes();
   }
 }
 
@@ -617,12 +1431,14 @@ void bdd_enginet::check_CTL(propertyt &property)
   {
     // intersection empty, proved
     property.proved();
+    properties.settled(property);
     message.status() << "Property proved" << messaget::eom;
   }
   else
   {
     // refuted
     property.refuted();
+    properties.settled(property);
     message.status() << "Property refuted" << messaget::eom;
   }
 }
@@ -742,22 +1558,7 @@ bdd_enginet::BDD bdd_enginet::EX(BDD f)
   for(const auto &c : constraints_BDDs)
     f = f & c;
 
-  // make 'f' be expressed in terms of 'next' variables
-  BDD p_next = current_to_next(f);
-
-  // now conjoin with transition relation
-  BDD conjunction = p_next;
-
-  for(const auto &t : transition_BDDs)
-    conjunction = conjunction & t;
-
-  for(const auto &c : constraints_BDDs)
-    conjunction = conjunction & c;
-
-  // now project away 'next' variables
-  BDD pre_image = project_next(conjunction);
-
-  return pre_image;
+  return pre_image(f);
 }
 
 /*******************************************************************\
@@ -779,6 +1580,8 @@ bdd_enginet::BDD bdd_enginet::fixedpoint(std::function<BDD(BDD)> tau, BDD x)
   {
     BDD image = tau(x);
 
+    update_peak_bdd_nodes();
+
     // fixpoint?
     if((image == x).is_true())
       return x; // done
@@ -927,11 +1730,84 @@ Function: bdd_enginet::build_BDDs
 
 void bdd_enginet::build_BDDs()
 {
+  // We currently only do sva_always assumptions.
+  std::vector<literalt> assumptions;
+
+  for(auto &property : properties.properties)
+    if(property.is_assumed())
+    {
+      auto &expr = property.normalized_expr;
+      if(
+        expr.id() == ID_sva_always &&
+        !has_temporal_operator(to_unary_expr(expr).op()))
+      {
+        // find the netlist property
+        auto netlist_property = netlist.properties.find(property.identifier);
+        CHECK_RETURN(netlist_property != netlist.properties.end());
+        assumptions.push_back(
+          std::get<netlistt::Gpt>(netlist_property->second).p);
+      }
+    }
+
+  // The nodes whose BDDs are needed once the netlist is converted.
+  std::vector<bool> is_root(netlist.nodes.size(), false);
+
+  auto add_root = [&is_root](literalt l) {
+    if(!l.is_constant())
+      is_root[l.var_no()] = true;
+  };
+
+  for(const auto &v : vars)
+    if(!v.second.is_input)
+      add_root(netlist.var_map.get_next(v.first));
+
+  for(literalt l : netlist.constraints)
+    add_root(l);
+
+  for(literalt l : netlist.initial)
+    add_root(l);
+
+  for(literalt l : netlist.transition)
+    add_root(l);
+
+  for(const auto &p : atomic_propositions)
+    add_root(p.second.l);
+
+  for(literalt l : assumptions)
+    add_root(l);
+
+  // Determine the nodes in the cone of influence of the roots, and
+  // count their fanouts within that cone. The nodes are in
+  // topological order.
+  std::vector<bool> in_cone = is_root;
+  std::vector<std::size_t> fanouts(netlist.nodes.size(), 0);
+
+  for(std::size_t i = netlist.nodes.size(); i-- != 0;)
+  {
+    const netlistt::nodet &n = netlist.nodes[i];
+
+    if(in_cone[i] && n.is_and())
+    {
+      for(literalt operand : {n.a, n.b})
+        if(!operand.is_constant())
+        {
+          in_cone[operand.var_no()] = true;
+          fanouts[operand.var_no()]++;
+        }
+    }
+  }
+
+  // Build the BDDs, releasing the BDD of a node once its last
+  // fanout has been built, unless it is a root. The manager frees
+  // the nodes that are no longer referenced.
   std::vector<BDD> BDDs;
   BDDs.resize(netlist.nodes.size());
 
   for(std::size_t i=0; i<netlist.nodes.size(); i++)
   {
+    if(!in_cone[i])
+      continue;
+
     const netlistt::nodet &n=netlist.nodes[i];
   
     // A node is either an 'and' or a variable/nondet
@@ -941,6 +1817,16 @@ void bdd_enginet::build_BDDs()
       BDD b=aig2bdd(n.b, BDDs);
     
       BDDs[i]=a & b;
+
+      for(literalt operand : {n.a, n.b})
+        if(!operand.is_constant())
+        {
+          auto var_no = operand.var_no();
+          if(--fanouts[var_no] == 0 && !is_root[var_no])
+            BDDs[var_no] = BDD();
+        }
+
+      update_peak_bdd_nodes();
     }
     else // current-state variable or nondet
     {
@@ -977,22 +1863,32 @@ void bdd_enginet::build_BDDs()
     p.second.bdd=aig2bdd(p.second.l, BDDs);
 
   // assumptions
-  for(auto &property : properties.properties)
-    if(property.is_assumed())
-    {
-      // We currently only do sva_always assumptions.
-      auto &expr = property.normalized_expr;
-      if(
-        expr.id() == ID_sva_always &&
-        !has_temporal_operator(to_unary_expr(expr).op()))
-      {
-        // find the netlist property
-        auto netlist_property = netlist.properties.find(property.identifier);
-        CHECK_RETURN(netlist_property != netlist.properties.end());
-        auto l = std::get<netlistt::Gpt>(netlist_property->second).p;
-        constraints_BDDs.push_back(aig2bdd(l, BDDs));
-      }
-    }
+  for(literalt l : assumptions)
+    constraints_BDDs.push_back(aig2bdd(l, BDDs));
+
+  // release the BDDs of the roots
+  BDDs.clear();
+}
+
+/*******************************************************************\
+
+Function: bdd_engine
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bdd_engine(
+  const cmdlinet &cmdline,
+  transition_systemt &transition_system,
+  ebmc_propertiest &properties,
+  message_handlert &message_handler)
+{
+  bdd_enginet(cmdline, transition_system, properties, message_handler)();
 }
 
 /*******************************************************************\
@@ -1011,6 +1907,41 @@ int do_bdd(
   const cmdlinet &cmdline,
   ui_message_handlert &ui_message_handler)
 {
-  return bdd_enginet(cmdline, ui_message_handler)();
-}
+  messaget message(ui_message_handler);
+
+  try
+  {
+    auto transition_system =
+      get_transition_system(cmdline, ui_message_handler);
+
+    auto properties = ebmc_propertiest::from_command_line(
+      cmdline, transition_system, ui_message_handler);
+
+    if(!cmdline.isset("show-bdds") && properties.properties.empty())
+    {
+      message.error() << "no properties" << messaget::eom;
+      return 1;
+    }
+
+    bdd_engine(cmdline, transition_system, properties, ui_message_handler);
+
+    if(cmdline.isset("show-bdds"))
+      return 0;
 
+    const namespacet ns(transition_system.symbol_table);
+    report_results(cmdline, properties, ns, ui_message_handler);
+
+    // We return '0' if all properties are proven,
+    // and '10' otherwise.
+    return properties.all_properties_proved() ? 0 : 10;
+  }
+  catch(const char *error_msg)
+  {
+    message.error() << error_msg << messaget::eom;
+    return 1;
+  }
+  catch(int)
+  {
+    return 1;
+  }
+}
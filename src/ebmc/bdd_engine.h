@@ -14,4 +14,15 @@ Author: Daniel Kroening, kroening@kroening.com
 
 int do_bdd(const cmdlinet &, ui_message_handlert &);
 
+class transition_systemt;
+class ebmc_propertiest;
+
+// Checks the given properties using BDDs. The result is stored
+// in the ebmc_propertiest argument.
+void bdd_engine(
+  const cmdlinet &,
+  transition_systemt &,
+  ebmc_propertiest &,
+  message_handlert &);
+
 #endif
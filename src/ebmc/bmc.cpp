@@ -8,18 +8,89 @@ Author: Daniel Kroening, dkr@amazon.com
 
 #include "bmc.h"
 
+#include <util/phase_statistics.h>
+
 #include <solvers/prop/literal_expr.h>
+#include <trans-word-level/linear_lasso.h>
 #include <trans-word-level/trans_trace_word_level.h>
 #include <trans-word-level/unwind.h>
 
 #include "ebmc_error.h"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
+#include <optional>
+
+/// The linear lasso encoding for the given properties, if it
+/// is requested, needed and supported.
+static std::optional<linear_lassot> make_linear_lasso(
+  lasso_encodingt lasso_encoding,
+  const transition_systemt &transition_system,
+  const ebmc_propertiest &properties,
+  const namespacet &ns,
+  message_handlert &message_handler)
+{
+  if(
+    lasso_encoding != lasso_encodingt::LINEAR ||
+    !properties.requires_lasso_constraints())
+  {
+    return {};
+  }
+
+  std::vector<exprt> property_exprs;
+
+  for(const auto &property : properties.properties)
+  {
+    if(
+      property.is_disabled() || property.is_failure() ||
+      !bmc_supports_property(property.normalized_expr))
+    {
+      continue;
+    }
+
+    if(!linear_lassot::supports(property.normalized_expr))
+    {
+      messaget message(message_handler);
+      message.warning() << "the linear lasso encoding requires state "
+                        << "predicates below F, using the quadratic encoding"
+                        << messaget::eom;
+      return {};
+    }
+
+    property_exprs.push_back(property.normalized_expr);
+  }
+
+  return linear_lassot(
+    property_exprs, ns, transition_system.main_symbol->name);
+}
+
+/// Adds the lasso constraints for the timeframes 0,...,last.
+static void lasso_constraints(
+  decision_proceduret &solver,
+  std::size_t last,
+  linear_lassot *linear_lasso,
+  const transition_systemt &transition_system,
+  const namespacet &ns)
+{
+  if(linear_lasso == nullptr)
+  {
+    ::lasso_constraints(
+      solver, last + 1, ns, transition_system.main_symbol->name);
+  }
+  else
+  {
+    for(std::size_t t = 0; t <= last; t++)
+      linear_lasso->add_timeframe(solver, t);
+
+    solver.set_to_true(linear_lasso->close(last));
+  }
+}
 
 void bmc(
   std::size_t bound,
   bool convert_only,
+  lasso_encodingt lasso_encoding,
   const transition_systemt &transition_system,
   ebmc_propertiest &properties,
   const ebmc_solver_factoryt &solver_factory,
@@ -35,8 +106,19 @@ void bmc(
   auto solver_wrapper = solver_factory(ns, message_handler);
   auto &solver = solver_wrapper.decision_procedure();
 
-  ::unwind(
-    transition_system.trans_expr, message_handler, solver, bound + 1, ns, true);
+  auto linear_lasso = make_linear_lasso(
+    lasso_encoding, transition_system, properties, ns, message_handler);
+
+  {
+    phase_timert timer("unwind");
+    ::unwind(
+      transition_system.trans_expr,
+      message_handler,
+      solver,
+      bound + 1,
+      ns,
+      true);
+  }
 
   // convert the properties
   message.status() << "Properties" << messaget::eom;
@@ -53,13 +135,16 @@ void bmc(
       continue;
     }
 
+    phase_timert timer("properties");
+
     ::property(
       property.normalized_expr,
       property.timeframe_handles,
       message_handler,
       solver,
       bound + 1,
-      ns);
+      ns,
+      linear_lasso.has_value() ? &*linear_lasso : nullptr);
 
     // If it's an assumption, then add it as constraint.
     if(property.is_assumed())
@@ -70,8 +155,48 @@ void bmc(
   if(properties.requires_lasso_constraints())
   {
     message.status() << "Adding lasso constraints" << messaget::eom;
+
+    const auto clauses_before = solver_wrapper.no_clauses();
+
     lasso_constraints(
-      solver, bound + 1, ns, transition_system.main_symbol->name);
+      solver,
+      bound,
+      linear_lasso.has_value() ? &*linear_lasso : nullptr,
+      transition_system,
+      ns);
+
+    // For comparison, the other encoding is converted on its own
+    // by a second solver. This is only done for the statistics.
+    if(
+      clauses_before.has_value() &&
+      message_handler.get_verbosity() >= messaget::M_STATISTICS)
+    {
+      null_message_handlert null_message_handler;
+      auto other_solver_wrapper = solver_factory(ns, null_message_handler);
+
+      auto other_linear_lasso = linear_lasso.has_value()
+                                  ? std::optional<linear_lassot>{}
+                                  : make_linear_lasso(
+                                      lasso_encodingt::LINEAR,
+                                      transition_system,
+                                      properties,
+                                      ns,
+                                      null_message_handler);
+
+      lasso_constraints(
+        other_solver_wrapper.decision_procedure(),
+        bound,
+        other_linear_lasso.has_value() ? &*other_linear_lasso : nullptr,
+        transition_system,
+        ns);
+
+      message.statistics()
+        << "Lasso constraints: "
+        << *solver_wrapper.no_clauses() - *clauses_before << " clauses ("
+        << other_solver_wrapper.no_clauses().value_or(0) << " with the "
+        << (other_linear_lasso.has_value() ? "linear" : "quadratic")
+        << " encoding)" << messaget::eom;
+    }
   }
 
   if(convert_only)
@@ -108,7 +233,12 @@ void bmc(
 
       auto assumption = not_exprt{conjunction(property.timeframe_handles)};
 
-      decision_proceduret::resultt dec_result = solver(assumption);
+      decision_proceduret::resultt dec_result;
+
+      {
+        phase_timert timer("solve");
+        dec_result = solver(assumption);
+      }
 
       switch(dec_result)
       {
@@ -124,12 +254,15 @@ void bmc(
           message.result() << "SAT: counterexample found" << messaget::eom;
         }
 
-        property.witness_trace = compute_trans_trace(
-          property.timeframe_handles,
-          solver,
-          bound + 1,
-          ns,
-          transition_system.main_symbol->name);
+        {
+          phase_timert timer("trace");
+          property.witness_trace = compute_trans_trace(
+            property.timeframe_handles,
+            solver,
+            bound + 1,
+            ns,
+            transition_system.main_symbol->name);
+        }
         break;
 
       case decision_proceduret::resultt::D_UNSATISFIABLE:
@@ -166,3 +299,188 @@ void bmc(
       << messaget::eom;
   }
 }
+
+void bmc_incremental(
+  std::size_t max_bound,
+  lasso_encodingt lasso_encoding,
+  const transition_systemt &transition_system,
+  ebmc_propertiest &properties,
+  const ebmc_solver_factoryt &solver_factory,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  const namespacet ns(transition_system.symbol_table);
+
+  // one solver for all bounds
+  auto solver_wrapper = solver_factory(ns, message_handler);
+  auto &solver = solver_wrapper.decision_procedure();
+
+  message.status() << "Solving with " << solver.decision_procedure_text()
+                   << messaget::eom;
+
+  for(auto &property : properties.properties)
+  {
+    if(property.is_disabled() || property.is_failure())
+      continue;
+
+    if(!bmc_supports_property(property.normalized_expr))
+      property.failure("property not supported by BMC engine");
+  }
+
+  const bool lasso = properties.requires_lasso_constraints();
+
+  auto linear_lasso = make_linear_lasso(
+    lasso_encoding, transition_system, properties, ns, message_handler);
+
+  // The properties that are still open.
+  auto is_open = [](const ebmc_propertiest::propertyt &property) {
+    return !property.is_disabled() && !property.is_failure() &&
+           !property.is_assumed() && !property.is_refuted() &&
+           !property.is_proved();
+  };
+
+  auto sat_start_time = std::chrono::steady_clock::now();
+
+  for(std::size_t bound = 0; bound <= max_bound; bound++)
+  {
+    if(std::none_of(
+         properties.properties.begin(), properties.properties.end(), is_open))
+    {
+      break;
+    }
+
+    message.status() << "Doing BMC with bound " << bound << messaget::eom;
+
+    // add timeframe 'bound' to the unwinding
+    {
+      phase_timert timer("unwind");
+      ::unwind_timeframe(
+        transition_system.trans_expr, message_handler, solver, bound, ns, true);
+    }
+
+    // The loops that end in the new timeframe.
+    if(linear_lasso.has_value())
+      linear_lasso->add_timeframe(solver, bound);
+    else if(lasso && bound != 0)
+    {
+      ::lasso_constraints_timeframe(
+        solver, bound, ns, transition_system.main_symbol->name);
+    }
+
+    // The property encodings depend on the bound, and are hence
+    // passed as assumptions, as are the assumed properties.
+    // The same holds for closing the loop of the linear lasso
+    // encoding in the new last timeframe.
+    exprt::operandst assumptions;
+
+    if(linear_lasso.has_value())
+      assumptions.push_back(linear_lasso->close(bound));
+
+    for(auto &property : properties.properties)
+    {
+      if(property.is_assumed())
+      {
+        phase_timert timer("properties");
+
+        ::property(
+          property.normalized_expr,
+          property.timeframe_handles,
+          message_handler,
+          solver,
+          bound + 1,
+          ns,
+          linear_lasso.has_value() ? &*linear_lasso : nullptr);
+
+        assumptions.push_back(conjunction(property.timeframe_handles));
+      }
+    }
+
+    for(auto &property : properties.properties)
+    {
+      // another engine may have settled the property meanwhile
+      properties.update(property);
+
+      if(!is_open(property))
+        continue;
+
+      {
+        phase_timert timer("properties");
+
+        ::property(
+          property.normalized_expr,
+          property.timeframe_handles,
+          message_handler,
+          solver,
+          bound + 1,
+          ns,
+          linear_lasso.has_value() ? &*linear_lasso : nullptr);
+      }
+
+      auto assumption = and_exprt{
+        conjunction(assumptions),
+        not_exprt{conjunction(property.timeframe_handles)}};
+
+      decision_proceduret::resultt dec_result;
+
+      {
+        phase_timert timer("solve");
+        dec_result = solver(assumption);
+      }
+
+      switch(dec_result)
+      {
+      case decision_proceduret::resultt::D_SATISFIABLE:
+        if(property.is_exists_path())
+        {
+          property.proved();
+          message.result() << "SAT: path found for " << property.name
+                           << " with bound " << bound << messaget::eom;
+        }
+        else // universal path property
+        {
+          property.refuted();
+          message.result() << "SAT: counterexample found for "
+                           << property.name << " with bound " << bound
+                           << messaget::eom;
+        }
+
+        properties.settled(property);
+
+        {
+          phase_timert timer("trace");
+          property.witness_trace = compute_trans_trace(
+            property.timeframe_handles,
+            solver,
+            bound + 1,
+            ns,
+            transition_system.main_symbol->name);
+        }
+        break;
+
+      case decision_proceduret::resultt::D_UNSATISFIABLE:
+        if(property.is_exists_path())
+          property.refuted_with_bound(bound);
+        else
+          property.proved_with_bound(bound);
+        break;
+
+      case decision_proceduret::resultt::D_ERROR:
+        message.error() << "Error from decision procedure" << messaget::eom;
+        property.failure();
+        break;
+
+      default:
+        property.failure();
+        throw ebmc_errort() << "Unexpected result from decision procedure";
+      }
+    }
+  }
+
+  auto sat_stop_time = std::chrono::steady_clock::now();
+
+  message.statistics()
+    << "Solver time: "
+    << std::chrono::duration<double>(sat_stop_time - sat_start_time).count()
+    << messaget::eom;
+}
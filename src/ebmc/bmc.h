@@ -12,16 +12,41 @@ Author: Daniel Kroening, dkr@amazon.com
 #ifndef EBMC_BMC_H
 #define EBMC_BMC_H
 
+#include <trans-word-level/property.h>
+
 #include "ebmc_properties.h"
 #include "ebmc_solver_factory.h"
 
 class exprt;
 class transition_systemt;
 
+/// The QUADRATIC encoding compares every pair of states, i.e.,
+/// considers loops that end in any timeframe. The LINEAR encoding,
+/// see linear_lassot, only considers loops that end in the last
+/// timeframe, and needs a number of constraints per timeframe that
+/// does not depend on the bound.
+enum class lasso_encodingt
+{
+  QUADRATIC,
+  LINEAR
+};
+
 /// This is word-level BMC.
 void bmc(
   std::size_t bound,
   bool convert_only,
+  lasso_encodingt,
+  const transition_systemt &,
+  ebmc_propertiest &,
+  const ebmc_solver_factoryt &,
+  message_handlert &);
+
+/// Word-level BMC that adds one timeframe at a time to a single
+/// solver, and checks the properties at each bound, up to and
+/// including the given maximum bound.
+void bmc_incremental(
+  std::size_t max_bound,
+  lasso_encodingt,
   const transition_systemt &,
   ebmc_propertiest &,
   const ebmc_solver_factoryt &,
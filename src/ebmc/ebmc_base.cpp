@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/cmdline.h>
 #include <util/config.h>
 #include <util/expr_util.h>
+#include <util/phase_statistics.h>
 #include <util/string2int.h>
 #include <util/unicode.h>
 
@@ -18,7 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <solvers/sat/satcheck.h>
 #include <trans-netlist/compute_ct.h>
 #include <trans-netlist/ldg.h>
-#include <trans-netlist/trans_to_netlist.h>
+#include <trans-netlist/netlist_coi.h>
 #include <trans-netlist/trans_trace_netlist.h>
 #include <trans-netlist/unwind_netlist.h>
 #include <trans-word-level/trans_trace_word_level.h>
@@ -90,7 +91,12 @@ int ebmc_baset::finish_bit_level_bmc(const bmc_mapt &bmc_map, propt &solver)
     bvt assumptions;
     assumptions.push_back(property_literal);
 
-    propt::resultt prop_result = solver.prop_solve(assumptions);
+    propt::resultt prop_result;
+
+    {
+      phase_timert timer("solve");
+      prop_result = solver.prop_solve(assumptions);
+    }
 
     switch(prop_result)
     {
@@ -101,6 +107,7 @@ int ebmc_baset::finish_bit_level_bmc(const bmc_mapt &bmc_map, propt &solver)
 
         namespacet ns(transition_system.symbol_table);
 
+        phase_timert timer("trace");
         property.witness_trace =
           compute_trans_trace(property.timeframe_literals, bmc_map, solver, ns);
       }
@@ -193,9 +200,32 @@ int ebmc_baset::do_bit_level_bmc(cnft &solver, bool convert_only)
 
     message.status() << "Unwinding Netlist" << messaget::eom;
 
-    bmc_map.map_timeframes(netlist, bound+1, solver);
+    if(cmdline.isset("no-coi"))
+      bmc_map.map_timeframes(netlist, bound + 1, solver);
+    else
+    {
+      // restrict the unwinding to the cone of influence
+      // of the properties we check or assume
+      std::set<irep_idt> property_ids;
+
+      for(const propertyt &property : properties.properties)
+        if(!property.is_disabled())
+          property_ids.insert(property.identifier);
+
+      netlist_coit coi;
+      coi.compute(netlist, netlist_coi_roots(netlist, property_ids));
 
-    ::unwind(netlist, bmc_map, message, solver);
+      message.statistics() << "Cone of influence: " << coi.number_of_nodes()
+                           << " of " << netlist.number_of_nodes() << " nodes"
+                           << messaget::eom;
+
+      bmc_map.map_timeframes(netlist, bound + 1, solver, coi);
+    }
+
+    {
+      phase_timert timer("unwind");
+      ::unwind(netlist, bmc_map, message, solver);
+    }
 
     const namespacet ns(transition_system.symbol_table);
 
@@ -215,6 +245,8 @@ int ebmc_baset::do_bit_level_bmc(cnft &solver, bool convert_only)
       auto netlist_property = netlist.properties.find(property.identifier);
       CHECK_RETURN(netlist_property != netlist.properties.end());
 
+      phase_timert timer("properties");
+
       ::unwind_property(
         netlist_property->second, bmc_map, property.timeframe_literals);
 
@@ -421,11 +453,10 @@ bool ebmc_baset::make_netlist(netlistt &netlist)
 
   try
   {
-    convert_trans_to_netlist(
-      transition_system.symbol_table,
-      transition_system.main_symbol->name,
-      netlist,
-      message.get_message_handler());
+    phase_timert timer("netlist");
+
+    convert_to_netlist(
+      transition_system, netlist, message.get_message_handler());
   }
   
   catch(const std::string &error_str)
@@ -438,6 +469,8 @@ bool ebmc_baset::make_netlist(netlistt &netlist)
                        << ", nodes: " << netlist.number_of_nodes()
                        << messaget::eom;
 
+  output_strash_statistics(netlist, message);
+
   return false;
 }
 
@@ -505,20 +538,22 @@ int ebmc_baset::do_word_level_bmc()
       const std::size_t max_bound =
         unsafe_string2size_t(cmdline.get_value("max-bound"));
 
-      for(bound = 1; bound <= max_bound; bound++)
-      {
-        message.status() << "Doing BMC with bound " << bound << messaget::eom;
+      if(properties.properties.empty())
+        throw "no properties";
 
-#if 0
-        const namespacet ns(transition_system.symbol_table);
-        CHECK_RETURN(trans_expr.has_value());
-        ::unwind(*trans_expr, *message_handler, solver, bound+1, ns, true);
-        result=finish_word_level_bmc(solver);
-#endif
-      }
+      bmc_incremental(
+        max_bound,
+        cmdline.isset("linear-lasso") ? lasso_encodingt::LINEAR
+                                      : lasso_encodingt::QUADRATIC,
+        transition_system,
+        properties,
+        solver_factory,
+        message.get_message_handler());
 
       const namespacet ns(transition_system.symbol_table);
       report_results(cmdline, properties, ns, message.get_message_handler());
+
+      result = properties.all_properties_proved() ? 0 : 10;
     }
     else
     {
@@ -532,6 +567,8 @@ int ebmc_baset::do_word_level_bmc()
       bmc(
         bound,
         convert_only,
+        cmdline.isset("linear-lasso") ? lasso_encodingt::LINEAR
+                                      : lasso_encodingt::QUADRATIC,
         transition_system,
         properties,
         solver_factory,
@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/exit_codes.h>
 #include <util/help_formatter.h>
 #include <util/string2int.h>
+#include <util/unicode.h>
 
 #include "bdd_engine.h"
 #include "diatest.h"
@@ -22,10 +23,12 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "k_induction.h"
 #include "liveness_to_safety.h"
 #include "neural_liveness.h"
+#include "portfolio.h"
 #include "random_traces.h"
 #include "ranking_function.h"
 #include "show_trans.h"
 
+#include <fstream>
 #include <iostream>
 
 #ifdef HAVE_INTERPOLATION
@@ -156,6 +159,9 @@ int ebmc_parse_optionst::doit()
     if(cmdline.isset("ic3"))
       return do_ic3(cmdline, ui_message_handler);
 
+    if(cmdline.isset("portfolio"))
+      return do_portfolio(cmdline, ui_message_handler);
+
     if(cmdline.isset("k-induction"))
       return do_k_induction(cmdline, ui_message_handler);
 
@@ -276,6 +282,19 @@ int ebmc_parse_optionst::doit()
         return 0;
       }
 
+      if(cmdline.isset("aiger-netlist"))
+      {
+        netlistt netlist;
+        if(ebmc_base.make_netlist(netlist))
+          return 1;
+        const std::string filename = cmdline.get_value("aiger-netlist");
+        std::ofstream out(widen_if_needed(filename), std::ios::binary);
+        if(!out)
+          throw ebmc_errort() << "failed to open `" << filename << "'";
+        netlist.output_aiger(out);
+        return 0;
+      }
+
       if(cmdline.isset("dot-netlist"))
       {
         netlistt netlist;
@@ -351,6 +370,7 @@ void ebmc_parse_optionst::help()
     "\n"
     "Additonal options:\n"
     " {y--bound} {unr}               \t set bound (default: 1)\n"
+    " {y--max-bound} {unr}           \t incremental BMC with bounds up to nr\n"
     " {y--module} {umodule}          \t set top module (deprecated)\n"
     " {y--top} {umodule}             \t set top module\n"
     " {y-p} {uexpr}                  \t specify a property\n"
@@ -364,15 +384,30 @@ void ebmc_parse_optionst::help()
     " {y--property} {uid}            \t check the property with given ID\n"
     " {y-I} {upath}                  \t set include path\n"
     " {y--systemverilog}             \t force SystemVerilog instead of Verilog\n"
+    " {y--jobs} {un}                 \t parse and type check in {un} processes\n"
+    " {y--cache-dir} {udirectory}    \t cache the type-checked modules in {udirectory}\n"
+    " {y--no-cache}                  \t do not use the module cache\n"
     " {y--reset} {uexpr}             \t set up module reset\n"
     " {y--liveness-to-safety}        \t translate liveness properties to safety properties\n"
+    " {y--linear-lasso}              \t use a lasso encoding that is linear in the bound\n"
     "\n"
     "Methods:\n"
-    " {y--k-induction}               \t do k-induction with k=bound\n"
+    " {y--k-induction}               \t do k-induction with k up to bound\n"
+    "    {y--simple-path}            \t add simple-path constraints to the step case\n"
+    " {y--portfolio}                 \t run BMC, k-induction and BDDs in parallel\n"
     " {y--bdd}                       \t use (unbounded) BDD engine\n"
+    "    {y--bdd-forward}            \t check AG properties by forward reachability\n"
+    "    {y--bdd-reorder}            \t reorder the BDD variables statically\n"
     " {y--ic3}                       \t use IC3 engine with options described below\n"
     "    {y--constr}                 \t use constraints specified in 'file.cnstr'\n"
     "    {y--new-mode}               \t new mode is switched on\n"
+    "    {y--single-solver}          \t use one SAT solver for all time frames\n"
+    "    {y--write-invariant} {ufile}\t write the inductive invariants to {ufile}\n"
+    "    {y--check-invariant} {ufile}\t check the inductive invariants in {ufile}\n"
+    "    {y--warm-start} {ufile}     \t start with the clauses of the invariants in {ufile}\n"
+    "    {y--lifting} {umode}        \t lift states by {usat} checks, {uternary} simulation or {umixed}\n"
+    "    {y--push-threads} {un}      \t push clauses forward in {un} threads\n"
+    "    {y--min-par-push} {un}      \t push clauses in threads if there are at least {un} (default: 64)\n"
     "    {y--aiger}                  \t print out the instance in aiger format\n"
     " {y--random-traces}             \t generate random traces\n"
     "    {y--number-of-traces} {unumber}\t generate the given number of traces\n"
@@ -396,6 +431,7 @@ void ebmc_parse_optionst::help()
     "\n"
     "Solvers:\n"
     " {y--aig}                       \t bit-level SAT with AIGs\n"
+    "    {y--no-coi}                 \t do not restrict the AIG to the cone of influence\n"
     " {y--dimacs}                    \t output bit-level CNF in DIMACS format\n"
     " {y--smt2}                      \t output word-level SMT 2 formula\n"
     " {y--boolector}                 \t use Boolector as solver\n"
@@ -415,6 +451,7 @@ void ebmc_parse_optionst::help()
     " {y--show-formula}              \t show the formula that is generated\n"
     " {y--smv-netlist}               \t show netlist in SMV format\n"
     " {y--dot-netlist}               \t show netlist in DOT format\n"
+    " {y--aiger-netlist} {ufile}     \t write netlist in binary AIGER format\n"
     " {y--show-trans}                \t show transition system\n"
     " {y--verbosity} {u#}            \t verbosity level, from 0 (silent) to 10 (everything)\n"
     // clang-format on
@@ -31,21 +31,24 @@ public:
         "(modules-xml):"
         "(show-properties)(property):p:(trace)(waveform)(numbered-trace)"
         "(dimacs)(module):(top):"
-        "(po)(cegar)(k-induction)(2pi)(bound2):"
-        "(outfile):(xml-ui)(verbosity):(gui)(json-result):"
+        "(po)(cegar)(k-induction)(simple-path)(portfolio)(2pi)(bound2):"
+        "(outfile):(xml-ui)(verbosity):(gui)(json-result):(jobs):"
+        "(cache-dir):(no-cache)"
         "(neural-liveness)(neural-engine):"
         "(reset):"
         "(version)(verilog-rtl)(verilog-netlist)"
         "(compute-interpolant)(interpolation)(interpolation-vmcai)"
-        "(ic3)(property):(constr)(h)(new-mode)(aiger)"
-        "(interpolation-word)(interpolator):(bdd)"
+        "(ic3)(property):(constr)(h)(new-mode)(aiger)(single-solver)"
+        "(write-invariant):(check-invariant):(warm-start):(lifting):"
+        "(push-threads):(min-par-push):(interpolation-word)(interpolator)"
+        "(bdd)(bdd-forward)(bdd-reorder)"
         "(ranking-function):"
         "(smt2)(bitwuzla)(boolector)(cvc3)(cvc4)(cvc5)(mathsat)(yices)(z3)"
-        "(aig)(stop-induction)(stop-minimize)(start):(coverage)(naive)"
-        "(compute-ct)(dot-netlist)(smv-netlist)(vcd):"
+        "(aig)(no-coi)(stop-induction)(stop-minimize)(start):(coverage)(naive)"
+        "(compute-ct)(dot-netlist)(smv-netlist)(aiger-netlist):(vcd):"
         "(random-traces)(trace-steps):(random-seed):(number-of-traces):"
         "(random-trace)(random-waveform)"
-        "(liveness-to-safety)"
+        "(liveness-to-safety)(linear-lasso)"
         "I:(preprocess)(systemverilog)(vl2smv-extensions)",
         argc,
         argv,
@@ -170,6 +170,37 @@ public:
   typedef std::list<propertyt> propertiest;
   propertiest properties;
 
+  /// Engines that run concurrently share their results through
+  /// this interface, see portfolio.cpp.
+  class sharingt
+  {
+  public:
+    virtual ~sharingt() = default;
+
+    /// Called before an engine works on the given property, and
+    /// between bounds. Copies in the result of another engine
+    /// that has settled the property meanwhile.
+    virtual void update(propertyt &) = 0;
+
+    /// Called as soon as an engine has proved or refuted
+    /// the given property.
+    virtual void settled(const propertyt &) = 0;
+  };
+
+  sharingt *sharing = nullptr;
+
+  void update(propertyt &property) const
+  {
+    if(sharing != nullptr)
+      sharing->update(property);
+  }
+
+  void settled(const propertyt &property) const
+  {
+    if(sharing != nullptr)
+      sharing->settled(property);
+  }
+
   bool all_properties_proved() const
   {
     for(const auto &p : properties)
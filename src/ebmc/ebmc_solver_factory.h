@@ -15,9 +15,11 @@ Author: Daniel Kroening, dkr@amazon.com
 
 #include <solvers/decision_procedure.h>
 #include <solvers/prop/prop.h>
+#include <solvers/sat/cnf.h>
 
 #include <iosfwd>
 #include <memory>
+#include <optional>
 
 class ebmc_solvert final
 {
@@ -47,6 +49,16 @@ public:
     return *decision_procedure_ptr;
   }
 
+  /// The number of clauses, if the solver is CNF-based
+  std::optional<std::size_t> no_clauses() const
+  {
+    auto cnf = dynamic_cast<const cnft *>(prop_ptr.get());
+    if(cnf == nullptr)
+      return {};
+    else
+      return cnf->no_clauses();
+  }
+
   // the objects are deleted in the opposite order they appear below
   std::unique_ptr<std::ofstream> ofstream_ptr;
   std::unique_ptr<propt> prop_ptr;
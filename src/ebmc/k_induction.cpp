@@ -8,20 +8,24 @@ Author: Daniel Kroening, daniel.kroening@inf.ethz.ch
 
 #include "k_induction.h"
 
+#include <util/phase_statistics.h>
 #include <util/string2int.h>
 
 #include <temporal-logic/temporal_logic.h>
 #include <trans-word-level/instantiate_word_level.h>
+#include <trans-word-level/property.h>
 #include <trans-word-level/trans_trace_word_level.h>
 #include <trans-word-level/unwind.h>
 
-#include "bmc.h"
 #include "ebmc_error.h"
 #include "ebmc_solver_factory.h"
 #include "liveness_to_safety.h"
 #include "report_results.h"
 
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
 
 /*******************************************************************\
 
@@ -36,11 +40,13 @@ class k_inductiont
 public:
   k_inductiont(
     std::size_t _k,
+    bool _simple_path,
     const transition_systemt &_transition_system,
     ebmc_propertiest &_properties,
     const ebmc_solver_factoryt &_solver_factory,
     message_handlert &_message_handler)
     : k(_k),
+      simple_path(_simple_path),
       transition_system(_transition_system),
       properties(_properties),
       solver_factory(_solver_factory),
@@ -61,13 +67,39 @@ public:
 
 protected:
   const std::size_t k;
+  const bool simple_path;
   const transition_systemt &transition_system;
   ebmc_propertiest &properties;
   const ebmc_solver_factoryt &solver_factory;
   messaget message;
 
-  void induction_base();
-  void induction_step();
+  // Both cases use one solver each for all properties and all
+  // values of k; the timeframe j is added on demand.
+  void induction_base(decision_proceduret &, std::size_t j);
+  void induction_step(decision_proceduret &, std::size_t j);
+
+  // the handles for the property in timeframes 0,...,j of the step case
+  std::map<irep_idt, exprt::operandst> step_handles;
+
+  // Simple-path constraints are added lazily: only the states that
+  // a step counterexample repeats are required to be different.
+  bool refine_simple_path(decision_proceduret &, std::size_t j);
+  std::vector<symbol_exprt> state_variables;
+  std::set<std::pair<std::size_t, std::size_t>> distinct_states;
+
+  static bool is_open(const ebmc_propertiest::propertyt &p)
+  {
+    return !p.is_disabled() && !p.is_failure() && !p.is_assumed() &&
+           !p.is_refuted() && !p.is_proved() && !p.is_inconclusive();
+  }
+
+  bool have_open_property() const
+  {
+    for(auto &p : properties.properties)
+      if(is_open(p))
+        return true;
+    return false;
+  }
 
   static bool supported(const ebmc_propertiest::propertyt &p)
   {
@@ -97,13 +129,19 @@ Function: do_k_induction
 
 void k_induction(
   std::size_t k,
+  bool simple_path,
   const transition_systemt &transition_system,
   ebmc_propertiest &properties,
   const ebmc_solver_factoryt &solver_factory,
   message_handlert &message_handler)
 {
   k_inductiont(
-    k, transition_system, properties, solver_factory, message_handler)();
+    k,
+    simple_path,
+    transition_system,
+    properties,
+    solver_factory,
+    message_handler)();
 }
 
 /*******************************************************************\
@@ -155,7 +193,12 @@ int do_k_induction(
   auto solver_factory = ebmc_solver_factory(cmdline);
 
   k_induction(
-    k, transition_system, properties, solver_factory, message_handler);
+    k,
+    cmdline.isset("simple-path"),
+    transition_system,
+    properties,
+    solver_factory,
+    message_handler);
 
   const namespacet ns(transition_system.symbol_table);
   report_results(cmdline, properties, ns, message_handler);
@@ -186,11 +229,51 @@ void k_inductiont::operator()()
       property.failure("property unsupported by k-induction");
   }
 
-  // do induction base
-  induction_base();
+  const namespacet ns(transition_system.symbol_table);
 
-  // do induction step
-  induction_step();
+  auto base_solver_wrapper = solver_factory(ns, message.get_message_handler());
+  auto &base_solver = base_solver_wrapper.decision_procedure();
+
+  auto step_solver_wrapper = solver_factory(ns, message.get_message_handler());
+  auto &step_solver = step_solver_wrapper.decision_procedure();
+
+  step_handles.clear();
+  distinct_states.clear();
+
+  if(simple_path)
+    state_variables =
+      ::state_variables(ns, transition_system.main_symbol->name);
+
+  // Increase j until all properties are proved or refuted,
+  // or until j exceeds k.
+  for(std::size_t j = 0; j <= k && have_open_property(); j++)
+  {
+    message.status() << "k-induction with k=" << j << messaget::eom;
+
+    // do induction base
+    induction_base(base_solver, j);
+
+    // do induction step
+    induction_step(step_solver, j);
+  }
+
+  if(simple_path)
+  {
+    message.statistics() << "Simple-path constraints: "
+                         << distinct_states.size() << messaget::eom;
+  }
+
+  for(auto &property : properties.properties)
+  {
+    if(is_open(property))
+    {
+      message.result() << property.name
+                       << ": inductive proof failed, k-induction is "
+                          "inconclusive"
+                       << messaget::eom;
+      property.inconclusive();
+    }
+  }
 }
 
 /*******************************************************************\
@@ -201,21 +284,111 @@ Function: k_inductiont::induction_base
 
  Outputs:
 
- Purpose:
+ Purpose: check that there is no counterexample of length j
 
 \*******************************************************************/
 
-void k_inductiont::induction_base()
+void k_inductiont::induction_base(decision_proceduret &solver, std::size_t j)
 {
   message.status() << "Induction Base" << messaget::eom;
 
-  bmc(
-    k,
-    false,
-    transition_system,
-    properties,
-    solver_factory,
-    message.get_message_handler());
+  const namespacet ns(transition_system.symbol_table);
+
+  // with initial state
+  {
+    phase_timert timer("unwind");
+    unwind_timeframe(
+      transition_system.trans_expr,
+      message.get_message_handler(),
+      solver,
+      j,
+      ns,
+      true);
+  }
+
+  // The encoding of the assumptions depends on the bound,
+  // and is hence passed as an assumption.
+  exprt::operandst assumptions;
+
+  for(auto &property : properties.properties)
+  {
+    if(property.is_assumed())
+    {
+      phase_timert timer("properties");
+      ::property(
+        property.normalized_expr,
+        property.timeframe_handles,
+        message.get_message_handler(),
+        solver,
+        j + 1,
+        ns);
+
+      assumptions.push_back(conjunction(property.timeframe_handles));
+    }
+  }
+
+  for(auto &property : properties.properties)
+  {
+    // another engine may have settled the property meanwhile
+    properties.update(property);
+
+    if(!is_open(property))
+      continue;
+
+    // If it's not failed, then it's supported.
+    DATA_INVARIANT(supported(property), "property must be supported");
+
+    // The timeframes before j have been checked already.
+    const exprt &p = to_unary_expr(property.normalized_expr).op();
+    property.timeframe_handles.resize(j);
+
+    {
+      phase_timert timer("properties");
+      property.timeframe_handles.push_back(
+        solver.handle(instantiate(p, j, j + 1, ns)));
+    }
+
+    auto assumption = and_exprt{
+      conjunction(assumptions), not_exprt{property.timeframe_handles.back()}};
+
+    decision_proceduret::resultt dec_result;
+
+    {
+      phase_timert timer("solve");
+      dec_result = solver(assumption);
+    }
+
+    switch(dec_result)
+    {
+    case decision_proceduret::resultt::D_SATISFIABLE:
+      message.result() << "SAT: counterexample found" << messaget::eom;
+      property.refuted();
+      properties.settled(property);
+      {
+        phase_timert timer("trace");
+        property.witness_trace = compute_trans_trace(
+          property.timeframe_handles,
+          solver,
+          j + 1,
+          ns,
+          transition_system.main_symbol->name);
+      }
+      break;
+
+    case decision_proceduret::resultt::D_UNSATISFIABLE:
+      property.proved_with_bound(j);
+      break;
+
+    case decision_proceduret::resultt::D_ERROR:
+      message.error() << "Error from decision procedure" << messaget::eom;
+      property.failure();
+      break;
+
+    default:
+      property.failure();
+      throw ebmc_errort() << "Unexpected result from decision procedure";
+    }
+  }
 }
 
 /*******************************************************************\
@@ -226,88 +399,91 @@ Function: k_inductiont::induction_step
 
  Outputs:
 
- Purpose:
+ Purpose: check that j states satisfying the property are
+          followed by a state satisfying the property
 
 \*******************************************************************/
 
-void k_inductiont::induction_step()
+void k_inductiont::induction_step(decision_proceduret &solver, std::size_t j)
 {
   message.status() << "Induction Step" << messaget::eom;
 
-  const std::size_t no_timeframes = k + 1;
   const namespacet ns(transition_system.symbol_table);
 
-  for(auto &p_it : properties.properties)
+  // *no* initial state
   {
-    if(p_it.is_disabled() || p_it.is_failure() || p_it.is_assumed())
-      continue;
+    phase_timert timer("unwind");
+    unwind_timeframe(
+      transition_system.trans_expr,
+      message.get_message_handler(),
+      solver,
+      j,
+      ns,
+      false);
+  }
 
-    // If it's not failed, then it's supported.
-    DATA_INVARIANT(supported(p_it), "property must be supported");
+  // add all assumptions for the new time frame
+  for(auto &property : properties.properties)
+    if(property.is_assumed())
+    {
+      phase_timert timer("properties");
+      const exprt &p = to_unary_expr(property.normalized_expr).op();
+      solver.set_to_true(instantiate(p, j, j + 1, ns));
+    }
+
+  for(auto &p_it : properties.properties)
+  {
+    properties.update(p_it);
 
     // Do not run the step case for properties that have
     // failed the base case already. Properties may pass the step
     // case, but are still false when the base case fails.
-    if(p_it.is_refuted())
+    if(!is_open(p_it))
       continue;
 
-    auto solver_wrapper = solver_factory(ns, message.get_message_handler());
-    auto &solver = solver_wrapper.decision_procedure();
+    const exprt &p = to_unary_expr(p_it.normalized_expr).op();
 
-    // *no* initial state
-    unwind(
-      transition_system.trans_expr,
-      message.get_message_handler(),
-      solver,
-      no_timeframes,
-      ns,
-      false);
-
-    // add all assumptions for all time frames
-    for(auto &property : properties.properties)
-      if(property.is_assumed())
-      {
-        const exprt &p = to_unary_expr(property.normalized_expr).op();
-        for(std::size_t c = 0; c < no_timeframes; c++)
-        {
-          exprt tmp = instantiate(p, c, no_timeframes, ns);
-          solver.set_to_true(tmp);
-        }
-      }
+    // The handles are added in the order of the timeframes, as the
+    // set of open properties only ever shrinks.
+    auto &handles = step_handles[p_it.identifier];
 
-    const exprt property(p_it.normalized_expr);
-    const exprt &p = to_unary_expr(property).op();
-
-    // assumption: time frames 0,...,k-1
-    for(std::size_t c = 0; c < no_timeframes - 1; c++)
     {
-      exprt tmp=
-        instantiate(p, c, no_timeframes-1, ns);
-      solver.set_to_true(tmp);
+      phase_timert timer("properties");
+      handles.push_back(solver.handle(instantiate(p, j, j + 1, ns)));
     }
-    
-    // property: time frame k
+
+    DATA_INVARIANT(handles.size() == j + 1, "one handle per timeframe");
+
+    // assumption: time frames 0,...,j-1
+    exprt::operandst assumptions(handles.begin(), std::prev(handles.end()));
+
+    // property: time frame j
+    assumptions.push_back(not_exprt{handles.back()});
+
+    decision_proceduret::resultt dec_result;
+
+    // With simple-path constraints, a step counterexample that
+    // repeats a state is ruled out, and we try again.
     {
-      exprt tmp=
-        instantiate(p, no_timeframes-1, no_timeframes, ns);
-      solver.set_to_false(tmp);
+      phase_timert timer("solve");
+      do
+        dec_result = solver(conjunction(assumptions));
+      while(dec_result == decision_proceduret::resultt::D_SATISFIABLE &&
+            simple_path && refine_simple_path(solver, j));
     }
 
-    decision_proceduret::resultt dec_result = solver();
-
     switch(dec_result)
     {
     case decision_proceduret::resultt::D_SATISFIABLE:
-      message.result()
-        << "SAT: inductive proof failed, k-induction is inconclusive"
-        << messaget::eom;
-      p_it.inconclusive();
+      message.progress() << "SAT: inductive proof failed with k=" << j
+                         << messaget::eom;
       break;
 
     case decision_proceduret::resultt::D_UNSATISFIABLE:
       message.result() << "UNSAT: inductive proof successful, property holds"
                        << messaget::eom;
       p_it.proved();
+      properties.settled(p_it);
       break;
 
     case decision_proceduret::resultt::D_ERROR:
@@ -318,3 +494,50 @@ void k_inductiont::induction_step()
     }
   }
 }
+
+/*******************************************************************\
+
+Function: k_inductiont::refine_simple_path
+
+  Inputs:
+
+ Outputs: true if constraints were added
+
+ Purpose: require the states that the step counterexample
+          repeats to be different
+
+\*******************************************************************/
+
+bool k_inductiont::refine_simple_path(
+  decision_proceduret &solver,
+  std::size_t j)
+{
+  if(state_variables.empty())
+    return false;
+
+  // the state in each timeframe of the counterexample
+  std::vector<exprt::operandst> states;
+  states.reserve(j + 1);
+
+  for(std::size_t t = 0; t <= j; t++)
+  {
+    states.emplace_back();
+    for(auto &var : state_variables)
+      states.back().push_back(solver.get(timeframe_symbol(t, var)));
+  }
+
+  bool refined = false;
+
+  for(std::size_t a = 0; a <= j; a++)
+    for(std::size_t b = a + 1; b <= j; b++)
+    {
+      if(states[a] == states[b] && distinct_states.insert({a, b}).second)
+      {
+        // These constraints remain valid for larger k.
+        solver.set_to_false(states_equal(a, b, state_variables));
+        refined = true;
+      }
+    }
+
+  return refined;
+}
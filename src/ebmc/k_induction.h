@@ -19,9 +19,14 @@ int do_k_induction(const cmdlinet &, ui_message_handlert &);
 class transition_systemt;
 class ebmc_propertiest;
 
-// Basic k-induction. The result is stored in the ebmc_propertiest argument.
+// k-induction for k=0,...,k, using one solver for the base case and
+// one for the step case across all properties and all values of k.
+// With simple_path, the step case is restricted to paths without
+// repeated states, which makes k-induction complete for finite-state
+// designs. The result is stored in the ebmc_propertiest argument.
 void k_induction(
   std::size_t k,
+  bool simple_path,
   const transition_systemt &,
   ebmc_propertiest &,
   const ebmc_solver_factoryt &,
@@ -0,0 +1,647 @@
+/*******************************************************************\
+
+Module: Portfolio Engine
+
+\*******************************************************************/
+
+#include "portfolio.h"
+
+#include <util/invariant.h>
+#include <util/irep_serialization.h>
+#include <util/string2int.h>
+
+#include "bdd_engine.h"
+#include "bmc.h"
+#include "ebmc_error.h"
+#include "ebmc_properties.h"
+#include "ebmc_solver_factory.h"
+#include "k_induction.h"
+#include "report_results.h"
+#include "transition_system.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#  include <sys/mman.h>
+#  include <sys/wait.h>
+
+#  include <atomic>
+#  include <cerrno>
+#  include <csignal>
+#  include <poll.h>
+#  include <unistd.h>
+#endif
+
+/// One member of the portfolio. The engine stores its results
+/// in the given properties.
+struct portfolio_enginet
+{
+  std::string name;
+  std::function<void(ebmc_propertiest &, message_handlert &)> run;
+};
+
+/// How much an engine result tells us about a property.
+/// Larger is better.
+static std::size_t
+result_strength(const ebmc_propertiest::propertyt &property)
+{
+  using statust = ebmc_propertiest::propertyt::statust;
+
+  switch(property.status)
+  {
+  case statust::PROVED:
+  case statust::REFUTED:
+    return 4;
+  case statust::PROVED_WITH_BOUND:
+  case statust::REFUTED_WITH_BOUND:
+    return 3;
+  case statust::INCONCLUSIVE:
+    return 2;
+  case statust::DROPPED:
+  case statust::FAILURE:
+    return 1;
+  case statust::UNKNOWN:
+  case statust::DISABLED:
+  case statust::ASSUMED:
+    return 0;
+  }
+
+  UNREACHABLE;
+}
+
+static bool is_settled(const ebmc_propertiest::propertyt &property)
+{
+  return property.is_disabled() || property.is_assumed() ||
+         property.is_proved() || property.is_refuted();
+}
+
+static bool all_settled(const ebmc_propertiest &properties)
+{
+  for(const auto &property : properties.properties)
+    if(!is_settled(property))
+      return false;
+
+  return true;
+}
+
+/// Merges the result of one engine for one property into the
+/// combined result. Returns true if that settles the property.
+static bool merge_result(
+  const ebmc_propertiest::propertyt &result,
+  ebmc_propertiest::propertyt &into)
+{
+  if(is_settled(into) || result.is_disabled() || result.is_assumed())
+    return false;
+
+  const auto old_strength = result_strength(into);
+  const auto new_strength = result_strength(result);
+
+  // a bounded result with a larger bound is better
+  if(
+    new_strength > old_strength ||
+    (new_strength == old_strength && result.bound > into.bound))
+  {
+    into.status = result.status;
+    into.bound = result.bound;
+    into.failure_reason = result.failure_reason;
+    into.witness_trace = result.witness_trace;
+    return is_settled(into);
+  }
+
+  return false;
+}
+
+#ifndef _WIN32
+/// A result is passed from a child process to the parent as one
+/// record: a line with the property number, the status, the bound
+/// and the sizes of the failure reason and of the trace, followed
+/// by the failure reason and the serialized trace.
+static std::string
+serialize_result(const ebmc_propertiest::propertyt &property)
+{
+  const std::string reason = property.failure_reason.value_or("");
+
+  std::ostringstream trace;
+  if(property.has_witness_trace())
+  {
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt(ireps_container)
+      .write_irep(trace, to_irep(property.witness_trace.value()));
+  }
+
+  std::ostringstream out;
+
+  out << property.number << ' ' << static_cast<int>(property.status) << ' '
+      << property.bound << ' ' << reason.size() << ' ' << trace.str().size()
+      << '\n'
+      << reason << trace.str();
+
+  return out.str();
+}
+
+enum class recordt
+{
+  INCOMPLETE,
+  MALFORMED,
+  COMPLETE
+};
+
+/// Takes the first record off the buffer, unless the buffer
+/// does not hold a complete record yet.
+static recordt deserialize_result(
+  std::string &buffer,
+  std::size_t &number,
+  ebmc_propertiest::propertyt &result)
+{
+  using statust = ebmc_propertiest::propertyt::statust;
+
+  const auto line_end = buffer.find('\n');
+  if(line_end == std::string::npos)
+    return recordt::INCOMPLETE;
+
+  std::istringstream in(buffer.substr(0, line_end));
+  int status;
+  std::size_t reason_size, trace_size;
+
+  if(!(in >> number >> status >> result.bound >> reason_size >> trace_size))
+    return recordt::MALFORMED;
+
+  const std::size_t record_size = line_end + 1 + reason_size + trace_size;
+  if(buffer.size() < record_size)
+    return recordt::INCOMPLETE;
+
+  result.status = static_cast<statust>(status);
+
+  if(reason_size == 0)
+    result.failure_reason = {};
+  else
+    result.failure_reason = buffer.substr(line_end + 1, reason_size);
+
+  if(trace_size == 0)
+    result.witness_trace = {};
+  else
+  {
+    std::istringstream trace(
+      buffer.substr(line_end + 1 + reason_size, trace_size));
+    irep_serializationt::ireps_containert ireps_container;
+    result.witness_trace = trans_trace_from_irep(
+      irep_serializationt(ireps_container).read_irep(trace));
+  }
+
+  buffer.erase(0, record_size);
+
+  return recordt::COMPLETE;
+}
+
+static void write_all(int fd, const std::string &data)
+{
+  const char *p = data.data();
+  std::size_t left = data.size();
+
+  while(left != 0)
+  {
+    auto written = write(fd, p, left);
+    if(written == -1)
+    {
+      if(errno == EINTR)
+        continue;
+      return;
+    }
+    p += written;
+    left -= written;
+  }
+}
+
+/// The status of each property, in memory that is shared by all
+/// portfolio processes. Zero means that no engine has settled the
+/// property yet.
+using shared_statust = std::atomic<int>;
+
+// the array must work across processes
+static_assert(shared_statust::is_always_lock_free);
+
+/// Used by the engines in the child processes. A property that an
+/// engine settles is entered into the shared status array, which the
+/// other engines check between properties and bounds, and is reported
+/// to the parent right away.
+class portfolio_sharingt : public ebmc_propertiest::sharingt
+{
+public:
+  using propertyt = ebmc_propertiest::propertyt;
+
+  portfolio_sharingt(shared_statust *_shared_status, int _fd)
+    : shared_status(_shared_status), fd(_fd)
+  {
+  }
+
+  void update(propertyt &property) override
+  {
+    current = &property;
+
+    if(is_settled(property))
+      return;
+
+    const int status = shared_status[property.number].load();
+
+    if(status != static_cast<int>(propertyt::statust::UNKNOWN))
+    {
+      property.status = static_cast<propertyt::statust>(status);
+      withdrawn.insert(property.number);
+    }
+  }
+
+  void settled(const propertyt &property) override
+  {
+    int expected = static_cast<int>(propertyt::statust::UNKNOWN);
+    shared_status[property.number].compare_exchange_strong(
+      expected, static_cast<int>(property.status));
+
+    reported.insert(property.number);
+    write_all(fd, serialize_result(property));
+  }
+
+  /// Reports the results that have not been reported yet,
+  /// except those taken from other engines.
+  void report_remaining(const ebmc_propertiest &properties)
+  {
+    for(const auto &property : properties.properties)
+    {
+      if(
+        reported.find(property.number) == reported.end() &&
+        withdrawn.find(property.number) == withdrawn.end())
+      {
+        write_all(fd, serialize_result(property));
+      }
+    }
+  }
+
+  // the property the engine is working on
+  propertyt *current = nullptr;
+
+protected:
+  shared_statust *shared_status;
+  int fd;
+  std::set<std::size_t> reported, withdrawn;
+};
+
+/// Runs the engine in the child process. An exception fails the
+/// property the engine was working on, and the engine is restarted
+/// on the remaining properties.
+static void run_child(
+  const portfolio_enginet &engine,
+  const ebmc_propertiest &properties,
+  shared_statust *shared_status,
+  int fd)
+{
+  null_message_handlert null_message_handler;
+  auto child_properties = properties;
+  portfolio_sharingt sharing(shared_status, fd);
+  child_properties.sharing = &sharing;
+
+  // each restart fails one property
+  for(std::size_t restarts = 0;; restarts++)
+  {
+    try
+    {
+      engine.run(child_properties, null_message_handler);
+      break;
+    }
+    catch(...)
+    {
+      auto current = sharing.current;
+      sharing.current = nullptr;
+
+      if(
+        current == nullptr || is_settled(*current) ||
+        restarts == child_properties.properties.size())
+      {
+        // we don't know which property is at fault
+        for(auto &property : child_properties.properties)
+          if(!is_settled(property))
+            property.failure(engine.name + " failed");
+        break;
+      }
+
+      current->failure(engine.name + " failed on this property");
+    }
+  }
+
+  sharing.report_remaining(child_properties);
+}
+
+struct portfolio_childt
+{
+  std::string name;
+  pid_t pid;
+  int fd;
+  std::string buffer;
+  bool done = false;
+  std::size_t settled = 0;
+};
+
+/// Runs each engine in a forked process, and merges the results
+/// as the processes report them. Processes are used instead of
+/// threads since the expression data structures are not thread-safe.
+static void run_portfolio(
+  const std::vector<portfolio_enginet> &engines,
+  ebmc_propertiest &properties,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  // the properties by number
+  std::vector<ebmc_propertiest::propertyt *> by_number;
+
+  for(auto &property : properties.properties)
+  {
+    PRECONDITION(property.number == by_number.size());
+    by_number.push_back(&property);
+  }
+
+  const std::size_t shared_size =
+    std::max(by_number.size(), std::size_t(1)) * sizeof(shared_statust);
+
+  void *shared_memory = mmap(
+    nullptr,
+    shared_size,
+    PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_ANONYMOUS,
+    -1,
+    0);
+
+  if(shared_memory == MAP_FAILED)
+    throw ebmc_errort() << "failed to map portfolio status array";
+
+  auto shared_status = static_cast<shared_statust *>(shared_memory);
+
+  for(std::size_t i = 0; i < by_number.size(); i++)
+    new(&shared_status[i]) shared_statust(0);
+
+  std::vector<portfolio_childt> children;
+
+  for(auto &engine : engines)
+  {
+    int fds[2];
+    if(pipe(fds) != 0)
+      throw ebmc_errort() << "failed to create pipe for portfolio engine";
+
+    // avoid duplicating buffered output
+    std::cout.flush();
+    std::cerr.flush();
+
+    pid_t pid = fork();
+
+    if(pid == -1)
+      throw ebmc_errort() << "failed to fork portfolio engine";
+
+    if(pid == 0)
+    {
+      // child
+      close(fds[0]);
+      for(auto &child : children)
+        close(child.fd);
+
+      run_child(engine, properties, shared_status, fds[1]);
+
+      close(fds[1]);
+      _exit(0);
+    }
+
+    // parent
+    close(fds[1]);
+    message.status() << "Portfolio: started " << engine.name << messaget::eom;
+    children.push_back(portfolio_childt{engine.name, pid, fds[0]});
+  }
+
+  // merges the complete records received from the child
+  auto merge_records = [&](portfolio_childt &child) {
+    while(true)
+    {
+      ebmc_propertiest::propertyt result;
+      std::size_t number;
+
+      const auto record = deserialize_result(child.buffer, number, result);
+
+      if(record == recordt::INCOMPLETE)
+        break;
+
+      if(record == recordt::MALFORMED)
+      {
+        // we can't find the start of the next record
+        message.warning() << "Portfolio: malformed result from "
+                          << child.name << messaget::eom;
+        child.buffer.clear();
+        break;
+      }
+
+      if(number >= by_number.size())
+      {
+        message.warning() << "Portfolio: result for unknown property from "
+                          << child.name << messaget::eom;
+        continue;
+      }
+
+      auto &property = *by_number[number];
+
+      if(merge_result(result, property))
+      {
+        child.settled++;
+        message.status() << "Portfolio: " << child.name << " settled "
+                         << property.name << messaget::eom;
+      }
+    }
+  };
+
+  auto open_children = children.size();
+
+  while(open_children != 0 && !all_settled(properties))
+  {
+    std::vector<pollfd> pollfds;
+    std::vector<portfolio_childt *> polled;
+
+    for(auto &child : children)
+    {
+      if(!child.done)
+      {
+        pollfds.push_back(pollfd{child.fd, POLLIN, 0});
+        polled.push_back(&child);
+      }
+    }
+
+    if(poll(pollfds.data(), pollfds.size(), -1) == -1)
+    {
+      if(errno == EINTR)
+        continue;
+      throw ebmc_errort() << "failed to poll portfolio engines";
+    }
+
+    for(std::size_t i = 0; i < pollfds.size(); i++)
+    {
+      if(pollfds[i].revents == 0)
+        continue;
+
+      auto &child = *polled[i];
+      char buffer[4096];
+      auto bytes = read(child.fd, buffer, sizeof(buffer));
+
+      if(bytes > 0)
+      {
+        child.buffer.append(buffer, bytes);
+        merge_records(child);
+        continue;
+      }
+
+      if(bytes == -1 && errno == EINTR)
+        continue;
+
+      // end of file, the child is done
+      child.done = true;
+      open_children--;
+      close(child.fd);
+
+      int status;
+      waitpid(child.pid, &status, 0);
+
+      if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+      {
+        message.status() << "Portfolio: " << child.name << " finished, "
+                         << child.settled << " properties settled"
+                         << messaget::eom;
+      }
+      else
+      {
+        message.warning() << "Portfolio: " << child.name
+                          << " terminated abnormally" << messaget::eom;
+      }
+    }
+  }
+
+  // stop the engines that are still running
+  for(auto &child : children)
+  {
+    if(!child.done)
+    {
+      kill(child.pid, SIGKILL);
+      close(child.fd);
+      waitpid(child.pid, nullptr, 0);
+      message.status() << "Portfolio: stopped " << child.name
+                       << messaget::eom;
+    }
+  }
+
+  munmap(shared_memory, shared_size);
+}
+#else
+/// There is no fork on Windows; the engines are run one after the other.
+static void run_portfolio(
+  const std::vector<portfolio_enginet> &engines,
+  ebmc_propertiest &properties,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  for(auto &engine : engines)
+  {
+    if(all_settled(properties))
+      break;
+
+    null_message_handlert null_message_handler;
+    auto engine_properties = properties;
+    engine.run(engine_properties, null_message_handler);
+
+    std::size_t settled = 0;
+    auto from_it = engine_properties.properties.begin();
+    for(auto &property : properties.properties)
+      if(merge_result(*(from_it++), property))
+        settled++;
+
+    message.status() << "Portfolio: " << engine.name << " finished, "
+                     << settled << " properties settled" << messaget::eom;
+  }
+}
+#endif
+
+/*******************************************************************\
+
+Function: do_portfolio
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+int do_portfolio(
+  const cmdlinet &cmdline,
+  ui_message_handlert &ui_message_handler)
+{
+  std::size_t bound = [&cmdline, &ui_message_handler]() -> std::size_t {
+    if(!cmdline.isset("bound"))
+    {
+      messaget message(ui_message_handler);
+      message.warning() << "using bound 1" << messaget::eom;
+      return 1;
+    }
+    else
+      return unsafe_string2size_t(cmdline.get_value("bound"));
+  }();
+
+  auto transition_system = get_transition_system(cmdline, ui_message_handler);
+
+  auto properties = ebmc_propertiest::from_command_line(
+    cmdline, transition_system, ui_message_handler);
+
+  if(properties.properties.empty())
+    throw ebmc_errort() << "no properties";
+
+  auto solver_factory = ebmc_solver_factory(cmdline);
+
+  std::vector<portfolio_enginet> engines;
+
+  engines.push_back(
+    {"BMC",
+     [&](ebmc_propertiest &properties, message_handlert &message_handler) {
+       bmc_incremental(
+         bound,
+         cmdline.isset("linear-lasso") ? lasso_encodingt::LINEAR
+                                       : lasso_encodingt::QUADRATIC,
+         transition_system,
+         properties,
+         solver_factory,
+         message_handler);
+     }});
+
+  engines.push_back(
+    {"k-induction",
+     [&](ebmc_propertiest &properties, message_handlert &message_handler) {
+       k_induction(
+         bound,
+         cmdline.isset("simple-path"),
+         transition_system,
+         properties,
+         solver_factory,
+         message_handler);
+     }});
+
+  engines.push_back(
+    {"BDD",
+     [&](ebmc_propertiest &properties, message_handlert &message_handler) {
+       bdd_engine(cmdline, transition_system, properties, message_handler);
+     }});
+
+  run_portfolio(engines, properties, ui_message_handler);
+
+  const namespacet ns(transition_system.symbol_table);
+  report_results(cmdline, properties, ns, ui_message_handler);
+
+  // We return '0' if all properties are proven,
+  // and '10' otherwise.
+  return properties.all_properties_proved() ? 0 : 10;
+}
@@ -0,0 +1,22 @@
+/*******************************************************************\
+
+Module: Portfolio Engine
+
+\*******************************************************************/
+
+/// \file
+/// Portfolio Engine
+
+#ifndef EBMC_PORTFOLIO_H
+#define EBMC_PORTFOLIO_H
+
+#include <util/cmdline.h>
+#include <util/ui_message.h>
+
+/// Runs BMC, k-induction and the BDD engine concurrently on the
+/// same properties. A property is settled by the first engine that
+/// proves or refutes it, and the other engines then skip it; the
+/// engines are stopped once all properties are settled.
+int do_portfolio(const cmdlinet &, ui_message_handlert &);
+
+#endif // EBMC_PORTFOLIO_H
@@ -12,6 +12,7 @@ Author: Daniel Kroening, dkr@amazon.com
 #include "report_results.h"
 
 #include <util/json.h>
+#include <util/phase_statistics.h>
 #include <util/unicode.h>
 #include <util/xml.h>
 
@@ -65,6 +66,20 @@ void report_results(
       json_properties.push_back(std::move(json_property));
     }
 
+    auto &json_phases = json_results["phases"].make_array();
+
+    for(const auto &phase : phase_statisticst::instance().phases())
+    {
+      json_objectt json_phase;
+      json_phase["name"] = json_stringt(phase.name);
+      json_phase["count"] = json_numbert(std::to_string(phase.count));
+      json_phase["seconds"] = json_numbert(std::to_string(phase.seconds));
+      json_phase["rss"] = json_numbert(std::to_string(phase.rss));
+      json_phase["rss_growth"] =
+        json_numbert(std::to_string(phase.rss_growth));
+      json_phases.push_back(std::move(json_phase));
+    }
+
     out << json_results;
   }
 
@@ -160,6 +175,14 @@ void report_results(
     }
   }
 
+  if(!phase_statisticst::instance().phases().empty())
+  {
+    messaget message(message_handler);
+    message.statistics() << "Phases:\n";
+    phase_statisticst::instance().output(message.statistics());
+    message.statistics() << messaget::eom;
+  }
+
   if(cmdline.isset("vcd"))
   {
     for(const auto &property : properties.properties)
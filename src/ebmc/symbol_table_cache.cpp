@@ -0,0 +1,310 @@
+/*******************************************************************\
+
+Module: On-Disk Cache for Type-Checked Symbol Tables
+
+\*******************************************************************/
+
+#include "symbol_table_cache.h"
+
+#include <util/cmdline.h>
+#include <util/config.h>
+#include <util/invariant.h>
+#include <util/irep_serialization.h>
+#include <util/unicode.h>
+
+#include <verilog/symbol_serialization.h>
+
+#include "ebmc_version.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/*******************************************************************\
+
+Function: fnv1a
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: 64-bit FNV-1a hash, as hex string
+
+\*******************************************************************/
+
+static std::string fnv1a(const std::string &data)
+{
+  std::uint64_t hash = 0xcbf29ce484222325u;
+
+  for(unsigned char ch : data)
+  {
+    hash ^= ch;
+    hash *= 0x100000001b3u;
+  }
+
+  std::ostringstream result;
+  result << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return result.str();
+}
+
+/*******************************************************************\
+
+Function: content_hash
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: hash of the contents of a file; empty if the file
+          cannot be read
+
+\*******************************************************************/
+
+static std::string content_hash(const std::string &filename)
+{
+  std::ifstream in(widen_if_needed(filename), std::ios::binary);
+  if(!in)
+    return {};
+
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  return fnv1a(contents.str());
+}
+
+/*******************************************************************\
+
+Function: symbol_table_cachet::symbol_table_cachet
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbol_table_cachet::symbol_table_cachet(
+  const cmdlinet &cmdline,
+  message_handlert &message_handler)
+  : message(message_handler)
+{
+  if(cmdline.isset("no-cache"))
+    return;
+
+  std::string directory;
+
+  if(cmdline.isset("cache-dir"))
+    directory = cmdline.get_value("cache-dir");
+  else if(const char *env = std::getenv("EBMC_CACHE_DIR"))
+    directory = env;
+
+  if(directory.empty())
+    return;
+
+  // the options that affect parsing and type checking
+  std::ostringstream key_stream;
+  key_stream << "ebmc " << EBMC_VERSION;
+  key_stream << "\tsystemverilog=" << cmdline.isset("systemverilog");
+  key_stream << "\tvl2smv-extensions=" << cmdline.isset("vl2smv-extensions");
+
+  for(const auto &path : config.verilog.include_paths)
+    key_stream << "\tI=" << path;
+
+  // the input files, with their contents
+  for(const auto &filename : cmdline.args)
+  {
+    auto hash = content_hash(filename);
+
+    // let the parser report the error
+    if(hash.empty())
+      return;
+
+    key_stream << '\t' << filename << '=' << hash;
+  }
+
+  key = key_stream.str();
+
+  cache_file =
+    (std::filesystem::path(directory) / ("ebmc-" + fnv1a(key) + ".cache"))
+      .string();
+}
+
+/*******************************************************************\
+
+Function: symbol_table_cachet::load
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool symbol_table_cachet::load(symbol_tablet &symbol_table)
+{
+  PRECONDITION(is_enabled());
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::ifstream in(widen_if_needed(cache_file), std::ios::binary);
+
+  auto miss = [this]() {
+    message.statistics() << "Symbol table cache miss" << messaget::eom;
+    return false;
+  };
+
+  if(!in)
+    return miss();
+
+  std::string line;
+
+  // the key must match, to guard against hash collisions
+  if(!std::getline(in, line) || line != key)
+    return miss();
+
+  double stored_seconds;
+  std::size_t number_of_included_files;
+
+  if(!(in >> stored_seconds >> number_of_included_files))
+    return miss();
+
+  in.ignore(1); // \n
+
+  // the included files must be unchanged
+  for(std::size_t i = 0; i < number_of_included_files; i++)
+  {
+    if(!std::getline(in, line))
+      return miss();
+
+    auto tab = line.rfind('\t');
+    if(tab == std::string::npos)
+      return miss();
+
+    if(content_hash(line.substr(0, tab)) != line.substr(tab + 1))
+      return miss();
+  }
+
+  std::size_t number_of_symbols;
+
+  if(!(in >> number_of_symbols))
+    return miss();
+
+  in.ignore(1); // \n
+
+  symbol_tablet result;
+
+  try
+  {
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt serializer(ireps_container);
+
+    for(std::size_t i = 0; i < number_of_symbols; i++)
+    {
+      irept irep = serializer.read_irep(in);
+
+      if(!in || result.add(symbol_from_irep(irep)))
+        return miss();
+    }
+  }
+  catch(...)
+  {
+    message.warning() << "ignoring corrupt cache file " << cache_file
+                      << messaget::eom;
+    return miss();
+  }
+
+  symbol_table.swap(result);
+
+  std::chrono::duration<double> seconds =
+    std::chrono::steady_clock::now() - start;
+
+  message.statistics() << "Symbol table cache hit, loaded in "
+                       << seconds.count() << "s, saving "
+                       << stored_seconds - seconds.count() << "s"
+                       << messaget::eom;
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: symbol_table_cachet::store
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void symbol_table_cachet::store(
+  const symbol_tablet &symbol_table,
+  const std::vector<std::string> &included_files,
+  double seconds)
+{
+  PRECONDITION(is_enabled());
+
+  // Write to a temporary file first, and then rename, as other
+  // processes may be using the same cache.
+  std::filesystem::path path(cache_file);
+
+  std::error_code error_code;
+  std::filesystem::create_directories(path.parent_path(), error_code);
+
+  std::string tmp_file = cache_file + ".tmp";
+#ifndef _WIN32
+  tmp_file += std::to_string(getpid());
+#endif
+
+  {
+    std::ofstream out(widen_if_needed(tmp_file), std::ios::binary);
+
+    if(!out)
+    {
+      message.warning() << "failed to write cache file " << cache_file
+                        << messaget::eom;
+      return;
+    }
+
+    out << key << '\n';
+    out << seconds << '\n';
+    out << included_files.size() << '\n';
+
+    for(const auto &file : included_files)
+      out << file << '\t' << content_hash(file) << '\n';
+
+    out << symbol_table.symbols.size() << '\n';
+
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt serializer(ireps_container);
+
+    for(const auto &symbol : symbol_table.symbols)
+      serializer.write_irep(out, symbol_to_irep(symbol.second));
+
+    if(!out)
+    {
+      message.warning() << "failed to write cache file " << cache_file
+                        << messaget::eom;
+      return;
+    }
+  }
+
+  std::filesystem::rename(tmp_file, path, error_code);
+
+  if(error_code)
+  {
+    message.warning() << "failed to write cache file " << cache_file
+                      << messaget::eom;
+    std::filesystem::remove(tmp_file, error_code);
+  }
+}
@@ -0,0 +1,54 @@
+/*******************************************************************\
+
+Module: On-Disk Cache for Type-Checked Symbol Tables
+
+\*******************************************************************/
+
+#ifndef CPROVER_EBMC_SYMBOL_TABLE_CACHE_H
+#define CPROVER_EBMC_SYMBOL_TABLE_CACHE_H
+
+#include <util/message.h>
+#include <util/symbol_table.h>
+
+#include <string>
+#include <vector>
+
+class cmdlinet;
+
+/// Caches the symbol table obtained by parsing and type checking the
+/// input files on disk. The cache entry is keyed by a hash of the
+/// contents of the input files and of the options that affect parsing
+/// and type checking. The entry records the included files with the
+/// hash of their contents, and is only used if these are unchanged.
+/// The cache is enabled by --cache-dir or the EBMC_CACHE_DIR
+/// environment variable, and is disabled by --no-cache.
+class symbol_table_cachet
+{
+public:
+  symbol_table_cachet(const cmdlinet &, message_handlert &);
+
+  bool is_enabled() const
+  {
+    return !cache_file.empty();
+  }
+
+  /// Returns true on a hit, with the symbol table filled in.
+  bool load(symbol_tablet &);
+
+  /// Stores the symbol table, with the given included files,
+  /// and the time it took to compute it.
+  void store(
+    const symbol_tablet &,
+    const std::vector<std::string> &included_files,
+    double seconds);
+
+protected:
+  messaget message;
+
+  // identifies the inputs and options
+  std::string key;
+
+  std::string cache_file;
+};
+
+#endif // CPROVER_EBMC_SYMBOL_TABLE_CACHE_H
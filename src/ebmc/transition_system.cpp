@@ -11,24 +11,40 @@ Author: Daniel Kroening, dkr@amazon.com
 #include <util/cmdline.h>
 #include <util/config.h>
 #include <util/get_module.h>
+#include <util/irep_serialization.h>
 #include <util/message.h>
 #include <util/namespace.h>
 #include <util/options.h>
+#include <util/phase_statistics.h>
+#include <util/string2int.h>
+#include <util/tempfile.h>
 #include <util/unicode.h>
 
+#include <aiger/aiger_language.h>
+#include <aiger/aiger_netlist.h>
 #include <langapi/language.h>
 #include <langapi/language_file.h>
 #include <langapi/language_util.h>
 #include <langapi/mode.h>
+#include <trans-netlist/trans_to_netlist.h>
 #include <trans-word-level/show_module_hierarchy.h>
 #include <trans-word-level/show_modules.h>
+#include <verilog/verilog_language.h>
 
 #include "ebmc_error.h"
 #include "ebmc_version.h"
+#include "symbol_table_cache.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 static void output(
   const exprt &expr,
   std::ostream &out,
@@ -72,6 +88,18 @@ void transition_systemt::output(std::ostream &out) const
   ::output(trans_expr.trans(), out, *language, ns);
 }
 
+static optionst language_options(const cmdlinet &cmdline)
+{
+  optionst options;
+  options.set_option("force-systemverilog", cmdline.isset("systemverilog"));
+  options.set_option("vl2smv-extensions", cmdline.isset("vl2smv-extensions"));
+
+  if(cmdline.isset("jobs"))
+    options.set_option("jobs", cmdline.get_value("jobs"));
+
+  return options;
+}
+
 int preprocess(const cmdlinet &cmdline, message_handlert &message_handler)
 {
   messaget message(message_handler);
@@ -108,11 +136,7 @@ int preprocess(const cmdlinet &cmdline, message_handlert &message_handler)
     return 1;
   }
 
-  optionst options;
-  options.set_option("force-systemverilog", cmdline.isset("systemverilog"));
-  options.set_option("vl2smv-extensions", cmdline.isset("vl2smv-extensions"));
-
-  language->set_language_options(options, message_handler);
+  language->set_language_options(language_options(cmdline), message_handler);
 
   if(language->preprocess(infile, filename, std::cout, message_handler))
   {
@@ -155,11 +179,7 @@ static bool parse(
 
   languaget &language = *lf.language;
 
-  optionst options;
-  options.set_option("force-systemverilog", cmdline.isset("systemverilog"));
-  options.set_option("vl2smv-extensions", cmdline.isset("vl2smv-extensions"));
-
-  language.set_language_options(options, message_handler);
+  language.set_language_options(language_options(cmdline), message_handler);
 
   message.status() << "Parsing " << filename << messaget::eom;
 
@@ -174,11 +194,145 @@ static bool parse(
   return false;
 }
 
+#ifndef _WIN32
+// Parses the Verilog files given on the command line in the given
+// number of worker processes, as the parser is not reentrant.
+// The parse trees are passed back to the parent in serialized form,
+// and are added in the order given on the command line.
+static bool parse_in_parallel(
+  const cmdlinet &cmdline,
+  std::size_t jobs,
+  language_filest &language_files,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+  const auto &files = cmdline.args;
+
+  // a temporary file for the parse tree of each Verilog file
+  std::vector<std::unique_ptr<temporary_filet>> parse_trees(files.size());
+
+  for(std::size_t i = 0; i < files.size(); i++)
+  {
+    auto language = get_language_from_filename(files[i]);
+    if(language != nullptr && language->id() == "Verilog")
+      parse_trees[i] = std::make_unique<temporary_filet>("ebmc-parse", "irep");
+  }
+
+  // don't duplicate buffered output in the workers
+  std::cout.flush();
+  std::cerr.flush();
+
+  std::vector<pid_t> workers;
+
+  for(std::size_t worker = 0; worker < jobs; worker++)
+  {
+    pid_t pid = fork();
+
+    if(pid == -1)
+      break; // the parent takes over
+
+    if(pid == 0)
+    {
+      // parse every jobs-th Verilog file
+      int exit_code = 0;
+
+      for(std::size_t i = worker; i < files.size(); i += jobs)
+      {
+        if(parse_trees[i] == nullptr)
+          continue;
+
+        language_filest worker_files;
+        if(parse(cmdline, files[i], worker_files, message_handler))
+        {
+          exit_code = 1;
+          break;
+        }
+
+        auto &language = static_cast<verilog_languaget &>(
+          *worker_files.file_map.begin()->second.language);
+
+        std::ofstream out(
+          widen_if_needed((*parse_trees[i])()), std::ios::binary);
+        irep_serializationt::ireps_containert ireps_container;
+        irep_serializationt(ireps_container)
+          .write_irep(out, language.get_parse_tree().to_irep());
+      }
+
+      std::cout.flush();
+      std::cerr.flush();
+      _exit(exit_code);
+    }
+
+    workers.push_back(pid);
+  }
+
+  bool error = false;
+
+  for(auto pid : workers)
+  {
+    int status;
+    if(waitpid(pid, &status, 0) == -1 || !WIFEXITED(status) ||
+       WEXITSTATUS(status) != 0)
+    {
+      error = true;
+    }
+  }
+
+  if(error)
+  {
+    message.error() << "parsing failed" << messaget::eom;
+    return true;
+  }
+
+  for(std::size_t i = 0; i < files.size(); i++)
+  {
+    // Files not parsed by a worker are parsed here.
+    if(parse_trees[i] == nullptr || i % jobs >= workers.size())
+    {
+      if(parse(cmdline, files[i], language_files, message_handler))
+        return true;
+      continue;
+    }
+
+    auto &lf = language_files.add_file(files[i]);
+    lf.filename = files[i];
+    lf.language = get_language_from_filename(files[i]);
+
+    std::ifstream in(widen_if_needed((*parse_trees[i])()), std::ios::binary);
+    irep_serializationt::ireps_containert ireps_container;
+    irept parse_tree = irep_serializationt(ireps_container).read_irep(in);
+
+    lf.language->set_language_options(
+      language_options(cmdline), message_handler);
+
+    static_cast<verilog_languaget &>(*lf.language)
+      .get_parse_tree()
+      .from_irep(parse_tree);
+
+    lf.get_modules();
+  }
+
+  return false;
+}
+#endif
+
 bool parse(
   const cmdlinet &cmdline,
   language_filest &language_files,
   message_handlert &message_handler)
 {
+#ifndef _WIN32
+  if(cmdline.isset("jobs") && cmdline.args.size() > 1)
+  {
+    std::size_t jobs = std::min(
+      std::size_t(unsafe_string2unsigned(cmdline.get_value("jobs"))),
+      cmdline.args.size());
+
+    if(jobs > 1)
+      return parse_in_parallel(cmdline, jobs, language_files, message_handler);
+  }
+#endif
+
   for(unsigned i = 0; i < cmdline.args.size(); i++)
   {
     if(parse(cmdline, cmdline.args[i], language_files, message_handler))
@@ -215,6 +369,79 @@ bool get_main(
   return false;
 }
 
+static int parse_and_typecheck(
+  const cmdlinet &cmdline,
+  message_handlert &message_handler,
+  symbol_tablet &symbol_table,
+  std::vector<std::string> &included_files,
+  std::shared_ptr<const aiger_parse_treet> &aig)
+{
+  messaget message(message_handler);
+
+  //
+  // parsing
+  //
+  language_filest language_files;
+
+  {
+    phase_timert timer("parse");
+
+    if(parse(cmdline, language_files, message_handler))
+      return 1;
+  }
+
+  if(cmdline.isset("show-parse"))
+  {
+    language_files.show_parse(std::cout, message_handler);
+    return 0;
+  }
+
+  for(auto &file : language_files.file_map)
+  {
+    if(file.second.language->id() == "Verilog")
+    {
+      const auto &parse_tree =
+        static_cast<verilog_languaget &>(*file.second.language)
+          .get_parse_tree();
+      included_files.insert(
+        included_files.end(),
+        parse_tree.included_files.begin(),
+        parse_tree.included_files.end());
+    }
+  }
+
+  //
+  // type checking
+  //
+
+  message.status() << "Converting" << messaget::eom;
+
+  {
+    phase_timert timer("typecheck");
+
+    if(language_files.typecheck(symbol_table, message_handler))
+    {
+      message.error() << "CONVERSION ERROR" << messaget::eom;
+      return 2;
+    }
+  }
+
+  // keep the AIG, for the netlist
+  for(auto &file : language_files.file_map)
+  {
+    if(file.second.language->id() == "AIGER")
+    {
+      auto parse_tree = std::make_shared<aiger_parse_treet>();
+      static_cast<aiger_languaget &>(*file.second.language)
+        .get_parse_tree()
+        .swap(*parse_tree);
+      aig = std::move(parse_tree);
+    }
+  }
+
+  return -1; // done
+}
+
 void make_next_state(exprt &expr)
 {
   for(auto &sub_expression : expr.operands())
@@ -238,30 +465,32 @@ int get_transition_system(
   if(cmdline.isset("preprocess"))
     return preprocess(cmdline, message_handler);
 
-  //
-  // parsing
-  //
-  language_filest language_files;
-
-  if(parse(cmdline, language_files, message_handler))
-    return 1;
+  symbol_table_cachet cache(cmdline, message_handler);
+  const bool use_cache = cache.is_enabled() && !cmdline.isset("show-parse");
 
-  if(cmdline.isset("show-parse"))
+  if(!use_cache || !cache.load(transition_system.symbol_table))
   {
-    language_files.show_parse(std::cout, message_handler);
-    return 0;
-  }
+    auto start = std::chrono::steady_clock::now();
 
-  //
-  // type checking
-  //
+    std::vector<std::string> included_files;
 
-  message.status() << "Converting" << messaget::eom;
+    auto exit_code = parse_and_typecheck(
+      cmdline,
+      message_handler,
+      transition_system.symbol_table,
+      included_files,
+      transition_system.aig);
 
-  if(language_files.typecheck(transition_system.symbol_table, message_handler))
-  {
-    message.error() << "CONVERSION ERROR" << messaget::eom;
-    return 2;
+    if(exit_code != -1)
+      return exit_code;
+
+    if(use_cache)
+    {
+      std::chrono::duration<double> seconds =
+        std::chrono::steady_clock::now() - start;
+      cache.store(
+        transition_system.symbol_table, included_files, seconds.count());
+    }
   }
 
   if(cmdline.isset("show-modules"))
@@ -337,6 +566,24 @@ transition_systemt get_transition_system(
   return transition_system;
 }
 
+void convert_to_netlist(
+  transition_systemt &transition_system,
+  netlistt &dest,
+  message_handlert &message_handler)
+{
+  const symbolt &main_symbol = *transition_system.main_symbol;
+
+  // An AIGER input gives the netlist straight from its literals,
+  // unless the symbol table came from the cache.
+  if(transition_system.aig != nullptr && main_symbol.mode == "AIGER")
+    aiger_netlist(*transition_system.aig, main_symbol.name, dest);
+  else
+  {
+    convert_trans_to_netlist(
+      transition_system.symbol_table, main_symbol.name, dest, message_handler);
+  }
+}
+
 int show_parse(const cmdlinet &cmdline, message_handlert &message_handler)
 {
   transition_systemt dummy_transition_system;
@@ -13,8 +13,12 @@ Author: Daniel Kroening, dkr@amazon.com
 #include <util/std_expr.h>
 #include <util/symbol_table.h>
 
+#include <memory>
+
+class aiger_parse_treet;
 class cmdlinet;
 class message_handlert;
+class netlistt;
 
 class transition_systemt
 {
@@ -28,11 +32,18 @@ public:
   const symbolt *main_symbol;
   transt trans_expr; // transition system expression
 
+  // the AIG of an AIGER input, which gives the netlist
+  // without going through the word-level model
+  std::shared_ptr<const aiger_parse_treet> aig;
+
   void output(std::ostream &) const;
 };
 
 transition_systemt get_transition_system(const cmdlinet &, message_handlert &);
 
+/// The netlist of the main module
+void convert_to_netlist(transition_systemt &, netlistt &, message_handlert &);
+
 int preprocess(const cmdlinet &, message_handlert &);
 int show_parse(const cmdlinet &, message_handlert &);
 int show_modules(const cmdlinet &, message_handlert &);
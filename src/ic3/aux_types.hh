@@ -144,6 +144,8 @@ struct ClauseInfo
                        // to the next time frame
   unsigned skip : 1; // if set to 1, this clause should be ignored when 
                      // pushing clauses forward
+  size_t push_span; // the span this clause was last added with to the 
+                    // SAT-solvers that push clauses in parallel
  
 };
 
@@ -160,9 +162,24 @@ struct SatSolver
   int num_calls; // number of calls since the last 'init_sat_solver' operation
   int init_num_vars;  // the initial number of variables
   int num_rel_vars; // number of released vars
+  int tf_ind; // if positive, 'Mst' is shared by all time frames and
+              // 'tf_ind' specifies the time frame this copy refers to
   PrevOper prev_oper; // specifies the previous operation
 };
 
+//
+//   PushTask
+//
+
+struct PushTask
+{
+  int clause_ind; // index of the clause of F to be pushed forward
+  std::vector <Mlit> Assmps; // negation of the clause in terms of
+                             // next state variables
+  bool unsat; // is 'true' if the clause can be pushed forward
+  CLAUSE C0; // if 'unsat' is true, the assumptions of the final conflict
+};
+
 //
 //   TimeFrame
 //
@@ -172,6 +189,8 @@ struct TimeFrame
 {
 
   SatSolver Slvr; // a copy of IctMinisat
+  int act_var; // if all time frames share one SAT-solver, the clauses
+               // of this time frame are enabled by this variable
   CUBE Clauses; // specifies the clauses of the current time frame
   // some clauses listed in 'Tf_cls' may be inactive
   int num_bnd_cls; // specifies number of boundary clauses of the 
@@ -0,0 +1,513 @@
+/******************************************************
+
+Module: Writing, checking and re-using inductive
+        invariants
+
+******************************************************/
+#include <queue>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+#include <ebmc/ebmc_base.h>
+
+#include "minisat/core/Solver.h"
+#include "minisat/simp/SimpSolver.h"
+#include "dnf_io.hh"
+#include "ccircuit.hh"
+#include "m0ic3.hh"
+
+#include "ebmc_ic3_interface.hh"
+
+/*======================================
+
+    F O R M _ C E R T _ N A M E S
+
+  Maps the present state variables to
+  the names of the latch bits of
+  'var_map'. A latch of several bits is
+  named as 'id[j]' like in AIGER files
+
+  =====================================*/
+void ic3_enginet::form_cert_names(std::map<int,std::string> &Var_names)
+{
+
+  Circuit *N = Ci.N;
+  std::map<CCUBE,int> Latch_vars;
+
+  for (size_t i=0; i < N->Gate_list.size(); i++) {
+    Gate &G = N->get_gate(i);
+    if (G.gate_type != LATCH) continue;
+    Latch_vars[G.Gate_name] = Ci.Gate_to_var[i];
+  }
+
+  var_mapt &vm = netlist.var_map;
+
+  for(var_mapt::mapt::const_iterator it=vm.map.begin();
+      it!=vm.map.end(); it++)    {
+    const var_mapt::vart &var=it->second;
+    if (!var.is_latch()) continue;
+
+    for (size_t j=0; j < var.bits.size(); j++) {
+      std::string Name = id2string(it->first);
+      if (var.bits.size() != 1)
+        Name += '[' + std::to_string(j) + ']';
+      literalt lit = var.bits[j].current;
+      CCUBE Latch_name;
+      form_latch_name(Latch_name,lit);
+      auto pnt = Latch_vars.find(Latch_name);
+      if (pnt == Latch_vars.end()) continue;
+      Var_names[pnt->second] = Name;
+    }
+  }
+
+} /* end of function form_cert_names */
+
+/*=============================
+
+     R E A D _ C E R T
+
+  The file consists of sections
+  started by a line
+  'property <name>'. Every other
+  line is a clause, i.e. a list of
+  latch bits separated by spaces.
+  A negated bit starts with '!'.
+  Clauses listed before the first
+  section are assigned to every
+  property. Lines starting with
+  '#' are comments
+
+  ============================*/
+bool ic3_enginet::read_cert(Certificate &Cert,const std::string &fname)
+{
+
+  std::ifstream in(fname);
+  if (!in) {
+    message.error() << "failed to open " << fname << messaget::eom;
+    return(false);
+  }
+
+  std::string Prop_name;
+  std::string Line;
+
+  while (std::getline(in,Line)) {
+    std::istringstream Words(Line);
+    std::string Word;
+    if (!(Words >> Word)) continue;
+    if (Word[0] == '#') continue;
+    if (Word == "property") {
+      if (!(Words >> Prop_name)) {
+        message.error() << fname << ": property name expected"
+                        << messaget::eom;
+        return(false);
+      }
+      Cert[Prop_name];
+      continue;
+    }
+
+    CertClause C;
+    do C.push_back(Word); while (Words >> Word);
+    Cert[Prop_name].push_back(C);
+  }
+
+  return(true);
+
+} /* end of function read_cert */
+
+/*=============================
+
+     W R I T E _ C E R T
+
+  ============================*/
+bool ic3_enginet::write_cert(Certificate &Cert,const std::string &fname)
+{
+
+  std::ofstream out(fname);
+  if (!out) {
+    message.error() << "failed to write " << fname << messaget::eom;
+    return(false);
+  }
+
+  out << "# inductive invariants found by IC3, one clause per line\n";
+
+  for (auto &Sect : Cert) {
+    out << "property " << Sect.first << '\n';
+    for (auto &C : Sect.second) {
+      for (size_t i=0; i < C.size(); i++) {
+        if (i > 0) out << ' ';
+        out << C[i];
+      }
+      out << '\n';
+    }
+  }
+
+  return(true);
+
+} /* end of function write_cert */
+
+/*=============================
+
+     S T O R E _ C E R T
+
+  Adds the invariant just found
+  to 'New_cert'
+
+  ============================*/
+void ic3_enginet::store_cert(const std::string &Prop_name)
+{
+
+  if (Ci.vac_true || (Ci.inv_ind < 0)) return;
+
+  std::map<int,std::string> Var_names;
+  form_cert_names(Var_names);
+
+  CNF H;
+  Ci.form_inv_clauses(H);
+
+  std::vector<CertClause> Clauses;
+
+  for (size_t i=0; i < H.size(); i++) {
+    CertClause C;
+    for (size_t j=0; j < H[i].size(); j++) {
+      int lit = H[i][j];
+      auto pnt = Var_names.find(abs(lit));
+      if (pnt == Var_names.end()) {
+        printf("invariant of %s is not written: ",Prop_name.c_str());
+        printf("it depends on an unnamed latch\n");
+        return;
+      }
+      C.push_back((lit < 0) ? '!' + pnt->second : pnt->second);
+    }
+    std::sort(C.begin(),C.end());
+    Clauses.push_back(C);
+  }
+
+  std::sort(Clauses.begin(),Clauses.end());
+  New_cert[Prop_name] = Clauses;
+
+} /* end of function store_cert */
+
+/*======================================
+
+    F O R M _ C E R T _ C L A U S E S
+
+  Converts 'Clauses' into clauses over
+  the present state variables. If
+  'skip_unknown' is true, the clauses
+  with an unknown latch bit are skipped.
+  Otherwise, 'false' is returned
+
+  =====================================*/
+bool ic3_enginet::form_cert_clauses(CNF &H,std::vector<CertClause> &Clauses,
+                                    bool skip_unknown)
+{
+
+  std::map<int,std::string> Var_names;
+  form_cert_names(Var_names);
+
+  std::map<std::string,int> Name_vars;
+  for (auto &El : Var_names)
+    Name_vars[El.second] = El.first;
+
+  for (auto &Nc : Clauses) {
+    CLAUSE C;
+    for (auto &Lit : Nc) {
+      bool neg = (Lit[0] == '!');
+      std::string Name = neg ? Lit.substr(1) : Lit;
+      auto pnt = Name_vars.find(Name);
+      if (pnt == Name_vars.end()) break;
+      C.push_back(neg ? -pnt->second : pnt->second);
+    }
+    if (C.size() < Nc.size()) {
+      if (skip_unknown) continue;
+      printf("unknown latch in the invariant\n");
+      return(false);
+    }
+    H.push_back(C);
+  }
+
+  return(true);
+
+} /* end of function form_cert_clauses */
+
+/*=============================
+
+     C H E C K _ C E R T
+
+  Checks the invariant of
+  property 'Prop_name' read
+  from a file instead of
+  running IC3
+
+  Returns:
+    2 - the invariant is valid
+    3 - otherwise
+
+  ============================*/
+int ic3_enginet::check_cert(const std::string &Prop_name)
+{
+
+  std::vector<CertClause> Clauses;
+  bool found = false;
+
+  std::set<std::string> Keys = {std::string(),Prop_name};
+  for (auto &Key : Keys) {
+    auto pnt = Old_cert.find(Key);
+    if (pnt == Old_cert.end()) continue;
+    found = true;
+    Clauses.insert(Clauses.end(),pnt->second.begin(),pnt->second.end());
+  }
+
+  if (!found) {
+    printf("no invariant for property %s\n",Prop_name.c_str());
+    return(3);
+  }
+
+  CNF H;
+  if (!form_cert_clauses(H,Clauses,false)) return(3);
+  return(Ci.run_inv_check(H));
+
+} /* end of function check_cert */
+
+/*==================================
+
+    F O R M _ W A R M _ S T A R T
+
+  Uses the clauses of all invariants
+  read from the file as candidate
+  lemmas
+
+  =================================*/
+void ic3_enginet::form_warm_start()
+{
+
+  std::vector<CertClause> Clauses;
+  for (auto &Sect : Old_cert)
+    Clauses.insert(Clauses.end(),Sect.second.begin(),Sect.second.end());
+
+  Ci.Inv_cands.clear();
+  form_cert_clauses(Ci.Inv_cands,Clauses,true);
+
+} /* end of function form_warm_start */
+
+/* ======================
+
+   R U N _ I N V _ C H E C K
+
+   ====================*/
+int CompInfo::run_inv_check(CNF &H)
+{
+
+  bool ok = check_init_states();
+  assert(ok);
+  assign_var_type();
+  assign_value();
+
+  htable_lits.hsh_init(4*max_num_vars+1);
+  form_bad_states();
+  form_property();
+  if (use_short_prop) form_short_property();
+
+  printf("\n");
+  ok = check_inv(H);
+  if (!ok) return(3);
+
+  printf("property HOLDS\n");
+  printf("invariant check is ok\n");
+  return(2);
+
+} /* end of function run_inv_check */
+
+/*===========================================
+
+    A D D _ I N V _ S E L E C T O R S
+
+  For every clause C of 'H', adds a new
+  variable s and the clauses equivalent to
+  s -> !C. The literals s are added to
+  'Sel_clause'
+
+  ==========================================*/
+void CompInfo::add_inv_selectors(SatSolver &Slvr,CNF &H,CLAUSE &Sel_clause)
+{
+
+  for (size_t i=0; i < H.size(); i++) {
+    int sel = Slvr.Mst->newVar()+1;
+    Sel_clause.push_back(sel);
+    for (size_t j=0; j < H[i].size(); j++) {
+      CLAUSE C;
+      C.push_back(-sel);
+      C.push_back(-H[i][j]);
+      accept_new_clause(Slvr,C);
+    }
+  }
+
+} /* end of function add_inv_selectors */
+
+/*=============================
+
+     C H E C K _ I N V
+
+  Returns 'true' if Prop & H is
+  an inductive invariant. Unlike
+  'ver_trans_inv', it makes one
+  SAT-check for initiation and
+  one for consecution. The
+  negation of Prop & H is
+  encoded by selector variables
+
+  ============================*/
+bool CompInfo::check_inv(CNF &H)
+{
+
+  std::string Name = "Gen_sat";
+
+  // initiation: Ist -> Prop & H
+  init_sat_solver(Gen_sat,max_num_vars,Name);
+  accept_new_clauses(Gen_sat,Ist);
+  accept_constrs(Gen_sat);
+  for (size_t i=0; i < Prop.size()-1; i++)
+    accept_new_clause(Gen_sat,Prop[i]);
+
+  CLAUSE Sel_clause;
+  add_inv_selectors(Gen_sat,H,Sel_clause);
+  int sel = Gen_sat.Mst->newVar()+1;
+  Sel_clause.push_back(sel);
+  CLAUSE U = Prop.back();
+  assert(U.size() == 1);
+  U[0] = -U[0];
+  U.push_back(-sel);
+  accept_new_clause(Gen_sat,U);
+  accept_new_clause(Gen_sat,Sel_clause);
+
+  bool sat_form = check_sat1(Gen_sat);
+  delete_solver(Gen_sat);
+  if (sat_form) {
+    printf("invariant check failed\n");
+    printf("Ist does not imply Prop & Inv\n");
+    return(false);
+  }
+
+  // consecution: Prop & H & Tr -> Prop' & H'
+  init_sat_solver(Gen_sat,max_num_vars,Name);
+  if (use_short_prop) accept_new_clauses(Gen_sat,Short_prop);
+  else accept_new_clauses(Gen_sat,Prop);
+  accept_new_clauses(Gen_sat,H);
+  accept_new_clauses(Gen_sat,Tr);
+
+  CNF Hn;
+  for (size_t i=0; i < H.size(); i++) {
+    CLAUSE C;
+    conv_to_next_state(C,H[i]);
+    Hn.push_back(C);
+  }
+
+  Sel_clause.clear();
+  add_inv_selectors(Gen_sat,Hn,Sel_clause);
+  sel = Gen_sat.Mst->newVar()+1;
+  Sel_clause.push_back(sel);
+  for (size_t i=0; i < Bad_states.size(); i++) {
+    CLAUSE C = Bad_states[i];
+    C.push_back(-sel);
+    accept_new_clause(Gen_sat,C);
+  }
+  accept_new_clause(Gen_sat,Sel_clause);
+
+  sat_form = check_sat1(Gen_sat);
+  delete_solver(Gen_sat);
+  if (sat_form) {
+    printf("invariant check failed\n");
+    printf("Prop & Inv & T does not imply Prop' & Inv'\n");
+    return(false);
+  }
+
+  return(true);
+
+} /* end of function check_inv */
+
+/*=====================================
+
+    F I L T E R _ I N V _ C A N D S
+
+  Adds to 'Lemmas' the largest subset
+  of 'Inv_cands' that holds initially
+  and is inductive by itself. Such
+  clauses hold in all reachable states.
+  The clauses that fail are dropped
+  one by one until a fixed point
+  is reached
+
+  ====================================*/
+void CompInfo::filter_inv_cands()
+{
+
+  std::string Name = "Gen_sat";
+
+  // drop the clauses excluding an initial state
+  init_sat_solver(Gen_sat,max_num_vars,Name);
+  accept_new_clauses(Gen_sat,Ist);
+  accept_constrs(Gen_sat);
+
+  CNF H;
+  for (size_t i=0; i < Inv_cands.size(); i++) {
+    MvecLits Assmps;
+    add_negated_assumps1(Assmps,Inv_cands[i]);
+    bool sat_form = check_sat2(Gen_sat,Assmps);
+    if (!sat_form) H.push_back(Inv_cands[i]);
+  }
+  delete_solver(Gen_sat);
+
+  // drop the clauses that are not implied
+  // in the next state by the remaining ones
+  init_sat_solver(Gen_sat,max_num_vars,Name);
+  accept_new_clauses(Gen_sat,Tr);
+
+  CUBE Act_vars;
+  for (size_t i=0; i < H.size(); i++) {
+    int act = Gen_sat.Mst->newVar()+1;
+    Act_vars.push_back(act);
+    CLAUSE C = H[i];
+    C.push_back(-act);
+    accept_new_clause(Gen_sat,C);
+  }
+
+  std::vector<bool> Dropped(H.size(),false);
+  bool changed = true;
+
+  while (changed) {
+    changed = false;
+    for (size_t i=0; i < H.size(); i++) {
+      if (Dropped[i]) continue;
+      MvecLits Assmps;
+      for (size_t j=0; j < H.size(); j++)
+        if (!Dropped[j])
+          Assmps.push(IctMinisat::mkLit(Act_vars[j]-1,false));
+      CLAUSE C;
+      conv_to_next_state(C,H[i]);
+      add_negated_assumps1(Assmps,C);
+      bool sat_form = check_sat2(Gen_sat,Assmps);
+      if (sat_form) {
+        Dropped[i] = true;
+        changed = true;
+      }
+    }
+  }
+
+  delete_solver(Gen_sat);
+
+  size_t num_kept = 0;
+  for (size_t i=0; i < H.size(); i++) {
+    if (Dropped[i]) continue;
+    Lemmas.push_back(H[i]);
+    num_kept++;
+  }
+
+  printf("warm start: %zu of %zu clauses still hold\n",num_kept,
+         Inv_cands.size());
+  Inv_cands.clear();
+
+} /* end of function filter_inv_cands */
@@ -89,6 +89,7 @@ void CompInfo::form_res_cnf(CNF &G,int tf_ind,CUBE &St_cube)
   SatSolver &Slvr = Time_frames[tf_ind].Slvr;
   MvecLits Assmps;
   add_assumps1(Assmps,St_cube);
+  if (Slvr.tf_ind > 0) add_tf_assumps(Assmps,Slvr.tf_ind);
   
   bool sat_form = Slvr.Mst->solve(Assmps);
   assert(sat_form == false);
@@ -1,6 +1,12 @@
 typedef std::vector<std::string> GateNames;
 typedef std::map<int,int> LatchVal;
 typedef std::map<int,int> NondetVars;
+typedef std::pair<CCUBE,bool> NamedLit; // latch name and sign (true means negation)
+typedef std::vector<NamedLit> NamedClause;
+typedef std::set<NamedClause> NamedCnf;
+typedef std::vector<std::string> CertClause; // latch bits, '!' means negation
+// clauses of inductive invariants, by property name
+typedef std::map<std::string,std::vector<CertClause>> Certificate;
 //
 class ic3_enginet
 {
@@ -18,8 +24,19 @@ protected:
 
   using propertyt = ebmc_propertiest::propertyt;
   ebmc_propertiest properties;
+  transition_systemt transition_system;
   netlistt netlist;
 
+  // clauses of the invariants of the properties proved so far,
+  // in terms of latch names
+  NamedCnf Lemmas;
+
+  // the invariants of the properties proved so far (New_cert) and
+  // the invariants read from the file given by --check-invariant
+  // or --warm-start (Old_cert), in terms of the latches of 'var_map'
+  Certificate New_cert;
+  Certificate Old_cert;
+
 public:
   CompInfo Ci;
   GateNames Gn;
@@ -30,6 +47,19 @@ public:
   bool orig_names;
 
   int operator()();
+  int check_all_properties();
+  bool supported_prop(propertyt &Prop);
+  void reset_engine();
+  void store_lemmas();
+  void form_lemmas();
+  void form_cert_names(std::map<int,std::string> &Var_names);
+  bool read_cert(Certificate &Cert,const std::string &fname);
+  bool write_cert(Certificate &Cert,const std::string &fname);
+  void store_cert(const std::string &Prop_name);
+  bool form_cert_clauses(CNF &H,std::vector<CertClause> &Clauses,
+                         bool skip_unknown);
+  int check_cert(const std::string &Prop_name);
+  void form_warm_start();
   void read_ebmc_input();  
   void find_prop_lit();
   void ebmc_form_latches();
@@ -55,10 +55,14 @@ void CompInfo::ci_init()
   }
 
   num_push_clause_calls = 0;
+  num_par_push_calls = 0;
   num_bstate_cubes = 0; 
   length_bstate_cubes = 0.;  
   num_gstate_cubes = 0; 
   length_gstate_cubes = 0.; 
+  num_tern_lifts = 0;
+  tern_rem_lits = 0;
+  sat_rem_lits = 0;
   old_state_cnt = 0;
   triv_old_st_cnt = 0;
   new_state_cnt = 0;
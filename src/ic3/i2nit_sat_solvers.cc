@@ -99,6 +99,11 @@ void CompInfo::assign_var_type()
   ============================================*/
 void CompInfo::init_time_frame_solver(int tf_ind)
 {
+
+  if (single_solver && (tf_ind > 0)) {
+    share_tf_solver(tf_ind);
+    return;
+  }
  
   SatSolver &Slvr = Time_frames[tf_ind].Slvr;
   char Name[MAX_NAME];
@@ -112,6 +117,41 @@ void CompInfo::init_time_frame_solver(int tf_ind)
 
 } /* end of function init_time_frame_solver */
 
+/*=======================================
+
+  S H A R E _ T F _ S O L V E R
+
+  Makes time frame 'tf_ind' use 'Tf_sat'.
+  The clauses of F_tf_ind are enabled by
+  assuming the activation literals of 
+  time frames tf_ind,tf_ind+1,..
+
+  ======================================*/
+void CompInfo::share_tf_solver(int tf_ind)
+{
+
+  if (tf_ind == 1) {
+    std::string Name = "Tf_sat";
+    init_sat_solver(Tf_sat,max_num_vars0,Name);
+    add_tf1_clauses(Tf_sat);
+  }
+
+  SatSolver &Slvr = Time_frames[tf_ind].Slvr;
+  char Name[MAX_NAME];
+  sprintf(Name,"Tf_sat%d",tf_ind);
+  Slvr.Name = Name;
+  Slvr.Mst = Tf_sat.Mst;
+  Slvr.tot_num_calls = 0;
+  Slvr.num_calls = 0;
+  Slvr.init_num_vars = Tf_sat.init_num_vars;
+  Slvr.num_rel_vars = 0;
+  Slvr.prev_oper = INIT;
+  Slvr.tf_ind = tf_ind;
+
+  Time_frames[tf_ind].act_var = Tf_sat.Mst->newVar();
+
+} /* end of function share_tf_solver */
+
 /*========================================
 
   I N I T _ L B S  _ S A T _ S O L V E R
@@ -41,6 +41,7 @@ bool CompInfo::check_sat2(SatSolver &Slvr,MvecLits &Assmps)
 
   Slvr.num_calls++;
   Slvr.tot_num_calls++;
+  if (Slvr.tf_ind > 0) add_tf_assumps(Assmps,Slvr.tf_ind);
   return(Slvr.Mst->solve(Assmps));
 
 } /* end of function check_sat2 */
@@ -85,6 +86,7 @@ void CompInfo::init_sat_solver(SatSolver &Slvr,int nvars,std::string &Id_name)
   Slvr.init_num_vars = S->nVars();
   Slvr.num_rel_vars = 0;
   Slvr.num_calls = 0;
+  Slvr.tf_ind = -1;
   Slvr.Mst = S;
 
 } /* end of function init_sat_solver */
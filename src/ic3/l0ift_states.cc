@@ -31,6 +31,34 @@ void CompInfo::lift_good_state(CUBE &Gst_cube,CUBE &Prs_st,
                                CUBE &Inps,CUBE &Nst_cube)
 {
 
+  CUBE Prs_st1;
+  rem_constr_lits(Prs_st1,Prs_st,Constr_ps_lits);  
+
+  if (lift_mode != SAT_LIFT) {
+    // the next state cube and the literals constraining
+    // internal variables have to stay true
+    CUBE Targets = Nst_cube;
+    SCUBE::iterator pnt;
+    for (pnt = Constr_nilits.begin(); pnt != Constr_nilits.end(); pnt++) {
+      int lit = *pnt;
+      int var_ind = abs(lit)-1;
+      if (Var_info[var_ind].type != INTERN) continue;
+      Targets.push_back(lit);
+    }
+
+    CUBE Prs_st2;
+    tern_lift(Prs_st2,Prs_st1,Prs_st,Inps,Targets);
+    Prs_st1 = Prs_st2;
+
+    if (lift_mode == TERN_LIFT) {
+      Gst_cube = Prs_st1;
+      num_gstate_cubes++;
+      length_gstate_cubes += Gst_cube.size();
+      add_constr_lits1(Gst_cube);
+      return;
+    }
+  }
+
   // add unit clauses specifying inputs
   MvecLits Assmps;
   CUBE Inps1;
@@ -46,8 +74,6 @@ void CompInfo::lift_good_state(CUBE &Gst_cube,CUBE &Prs_st,
  
   Assmps.push(act_lit);
 
-  CUBE Prs_st1;
-  rem_constr_lits(Prs_st1,Prs_st,Constr_ps_lits);  
   add_assumps2(Assmps,Prs_st1);
   
   bool sat_form = check_sat2(Lgs_sat,Assmps);
@@ -61,6 +87,7 @@ void CompInfo::lift_good_state(CUBE &Gst_cube,CUBE &Prs_st,
   
 
   gen_state_cube(Gst_cube,Prs_st1,Lgs_sat);
+  sat_rem_lits += Prs_st1.size() - Gst_cube.size();
 
   release_lit(Lgs_sat,~act_lit);
 
@@ -79,6 +106,33 @@ void CompInfo::lift_good_state(CUBE &Gst_cube,CUBE &Prs_st,
 void CompInfo::lift_bad_state(CUBE &Bst_cube,CUBE &St,CUBE &Inps)
 {
 
+  CUBE St1;
+  rem_constr_lits(St1,St,Constr_ps_lits);
+
+  if (lift_mode != SAT_LIFT) {
+    // the state has to stay bad and the literals
+    // constraining internal variables true
+    CUBE Targets;
+    Targets.push_back(-Prop.back()[0]);
+    Targets.insert(Targets.end(),Fun_coi_lits.begin(),Fun_coi_lits.end());
+
+    CUBE St2;
+    bool ok = tern_lift(St2,St1,St,Inps,Targets);
+    St1 = St2;
+
+    if (lift_mode == TERN_LIFT) {
+      if (!ok) {
+        Bst_cube = St;
+        return;
+      }
+      Bst_cube = St1;
+      num_bstate_cubes++;
+      length_bstate_cubes += Bst_cube.size();
+      add_constr_lits1(Bst_cube);
+      return;
+    }
+  }
+
   TrivMclause Assmps;
 
   CUBE Inps1;
@@ -86,8 +140,6 @@ void CompInfo::lift_bad_state(CUBE &Bst_cube,CUBE &St,CUBE &Inps)
 
   add_assumps1(Assmps,Inps1);
 
-  CUBE St1;
-  rem_constr_lits(St1,St,Constr_ps_lits);
   add_assumps2(Assmps,St1);
 
  
@@ -100,6 +152,7 @@ void CompInfo::lift_bad_state(CUBE &Bst_cube,CUBE &St,CUBE &Inps)
   }
 
   gen_state_cube(Bst_cube,St1,Lbs_sat);
+  sat_rem_lits += St1.size() - Bst_cube.size();
  
   num_bstate_cubes++;
   length_bstate_cubes += Bst_cube.size();
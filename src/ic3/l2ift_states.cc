@@ -0,0 +1,268 @@
+/******************************************************
+
+Module: Lifting states, i.e. turning states into
+        cubes of states (Part 3). Ternary simulation
+
+******************************************************/
+#include <iostream>
+#include <queue>
+#include <set>
+#include <map>
+#include <algorithm>
+#include "minisat/core/Solver.h"
+#include "minisat/simp/SimpSolver.h"
+#include "dnf_io.hh"
+#include "ccircuit.hh"
+#include "m0ic3.hh"
+
+extern int form_index(CUBE &C);
+
+/*=======================================
+
+     F O R M _ S I M _ O R D E R
+
+  Orders the gates of N that are not
+  inputs or latches topologically
+
+  ======================================*/
+void CompInfo::form_sim_order()
+{
+
+  size_t num_gates = N->Gate_list.size();
+
+  Sim_order.clear();
+  Sim_pos.assign(num_gates,-1);
+  Var_to_gate.assign(num_circ_vars+1,-1);
+  for (size_t i=0; i < num_gates; i++)
+    Var_to_gate[Gate_to_var[i]] = i;
+
+  // 0 - not visited, 1 - visited, 2 - ordered
+  CCUBE Mark(num_gates,0);
+
+  for (size_t i=0; i < num_gates; i++) {
+    if (Mark[i] != 0) continue;
+    std::vector<std::pair<int,size_t>> Stack;
+    Stack.push_back(std::make_pair(i,0));
+    Mark[i] = 1;
+
+    while (Stack.size() > 0) {
+      int gate_ind = Stack.back().first;
+      Gate &G = N->get_gate(gate_ind);
+      bool source = (G.gate_type == INPUT) || (G.gate_type == LATCH);
+      size_t k = Stack.back().second;
+      if (!source && (k < G.Fanin_list.size())) {
+        Stack.back().second++;
+        int fanin_ind = G.Fanin_list[k];
+        if (Mark[fanin_ind] != 0) continue;
+        Mark[fanin_ind] = 1;
+        Stack.push_back(std::make_pair(fanin_ind,0));
+        continue;
+      }
+
+      Mark[gate_ind] = 2;
+      Stack.pop_back();
+      if (source) continue;
+      Sim_pos[gate_ind] = Sim_order.size();
+      Sim_order.push_back(gate_ind);
+    }
+  }
+
+} /* end of function form_sim_order */
+
+/*=======================================
+
+         T E R N _ E V A L
+
+  Returns the value of the output of
+  gate 'gate_ind' under the values of
+  its inputs in 'Tern_vals'
+
+  ======================================*/
+char CompInfo::tern_eval(int gate_ind)
+{
+
+  Gate &G = N->get_gate(gate_ind);
+
+  switch (G.func_type) {
+  case CONST:
+    return((G.F.size() == 1) ? 1 : 0);
+  case BUFFER: {
+    char val = Tern_vals[G.Fanin_list[0]];
+    if (val == TERN_X) return(TERN_X);
+    return(val ^ G.Polarity[0]);}
+  case AND:
+  case OR: {
+    char ctrl_val = (G.func_type == AND) ? 0 : 1;
+    bool unknown = false;
+    for (size_t i=0; i < G.Fanin_list.size(); i++) {
+      char val = Tern_vals[G.Fanin_list[i]];
+      if (val == TERN_X) {
+        unknown = true;
+        continue;
+      }
+      if ((val ^ G.Polarity[i]) == ctrl_val) return(ctrl_val);
+    }
+    if (unknown) return(TERN_X);
+    return(1-ctrl_val);}
+  case TRUTH_TABLE: {
+    // the output is known if it is the same
+    // for all values of the unknown inputs
+    CUBE Unknown;
+    int index = 0;
+    for (size_t i=0; i < G.Fanin_list.size(); i++) {
+      char val = Tern_vals[G.Fanin_list[i]];
+      if (val == TERN_X) Unknown.push_back(i);
+      else if (val == 1) index |= 1 << i;
+    }
+
+    char res = TERN_X;
+    for (int m=0; m < (1 << Unknown.size()); m++) {
+      int index1 = index;
+      for (size_t j=0; j < Unknown.size(); j++)
+        if (m & (1 << j)) index1 |= 1 << Unknown[j];
+      char val = 0;
+      for (size_t j=0; j < G.F.size(); j++)
+        if (form_index(G.F[j]) == index1) {
+          val = 1;
+          break;
+        }
+      if (res == TERN_X) res = val;
+      else if (res != val) return(TERN_X);
+    }
+    return(res);}
+  default:
+    assert(false);
+  }
+
+  return(TERN_X);
+
+} /* end of function tern_eval */
+
+/*=======================================
+
+       T E R N _ L I T _ V A L
+
+  ======================================*/
+char CompInfo::tern_lit_val(int lit)
+{
+
+  char val = Tern_vals[Var_to_gate[abs(lit)]];
+  if (val == TERN_X) return(TERN_X);
+  return((lit > 0) ? val : 1-val);
+
+} /* end of function tern_lit_val */
+
+/*=======================================
+
+      T E R N _ P R O P A G A T E
+
+  Propagates the change of the value of
+  gate 'gate_ind' to its transitive
+  fanout, not crossing latches. The old
+  values of the gates that changed are
+  added to 'Changed'. Returns 'false' as
+  soon as a target gate becomes unknown
+
+  ======================================*/
+bool CompInfo::tern_propagate(int gate_ind,
+                              std::vector<std::pair<int,char>> &Changed)
+{
+
+  std::set<int> Queue;
+
+  CUBE &Fanout = N->get_gate(gate_ind).Fanout_list;
+  for (size_t i=0; i < Fanout.size(); i++)
+    if (Sim_pos[Fanout[i]] >= 0) Queue.insert(Sim_pos[Fanout[i]]);
+
+  while (Queue.size() > 0) {
+    int pos = *Queue.begin();
+    Queue.erase(Queue.begin());
+    int gate_ind1 = Sim_order[pos];
+    char val = tern_eval(gate_ind1);
+    if (val == Tern_vals[gate_ind1]) continue;
+
+    Changed.push_back(std::make_pair(gate_ind1,Tern_vals[gate_ind1]));
+    Tern_vals[gate_ind1] = val;
+    if (Tern_targets[gate_ind1]) return(false);
+
+    CUBE &Fanout1 = N->get_gate(gate_ind1).Fanout_list;
+    for (size_t i=0; i < Fanout1.size(); i++)
+      if (Sim_pos[Fanout1[i]] >= 0) Queue.insert(Sim_pos[Fanout1[i]]);
+  }
+
+  return(true);
+
+} /* end of function tern_propagate */
+
+/*=======================================
+
+          T E R N _ L I F T
+
+  Removes from 'Cands' the literals that
+  are not needed to keep the literals of
+  'Targets' true under inputs 'Inps'.
+  The values of variables are set to X
+  one by one and the change is propagated
+  by ternary simulation. The literals
+  that are kept are added to 'St_cube'
+
+  Returns 'false' if 'Targets' is not
+  implied by 'St' and 'Inps'. In this case
+  'St_cube' is equal to 'Cands'
+
+  ASSUMPTIONS:
+    1) 'Cands' is a subset of 'St'
+    2) 'St' and 'Inps' are given in terms
+       of present state and input variables
+
+  ======================================*/
+bool CompInfo::tern_lift(CUBE &St_cube,CUBE &Cands,CUBE &St,CUBE &Inps,
+                         CUBE &Targets)
+{
+
+  if (Sim_pos.size() == 0) form_sim_order();
+
+  num_tern_lifts++;
+  size_t num_gates = N->Gate_list.size();
+
+  Tern_vals.assign(num_gates,TERN_X);
+  for (size_t i=0; i < Inps.size(); i++)
+    Tern_vals[Var_to_gate[abs(Inps[i])]] = (Inps[i] > 0);
+  for (size_t i=0; i < St.size(); i++)
+    Tern_vals[Var_to_gate[abs(St[i])]] = (St[i] > 0);
+  for (size_t i=0; i < Sim_order.size(); i++)
+    Tern_vals[Sim_order[i]] = tern_eval(Sim_order[i]);
+
+  Tern_targets.assign(num_gates,0);
+  for (size_t i=0; i < Targets.size(); i++) {
+    if (tern_lit_val(Targets[i]) != 1) {
+      St_cube = Cands;
+      return(false);
+    }
+    Tern_targets[Var_to_gate[abs(Targets[i])]] = 1;
+  }
+
+  for (size_t i=0; i < Cands.size(); i++) {
+    int gate_ind = Var_to_gate[abs(Cands[i])];
+    if (Tern_targets[gate_ind]) {
+      St_cube.push_back(Cands[i]);
+      continue;
+    }
+
+    std::vector<std::pair<int,char>> Changed;
+    Changed.push_back(std::make_pair(gate_ind,Tern_vals[gate_ind]));
+    Tern_vals[gate_ind] = TERN_X;
+    if (tern_propagate(gate_ind,Changed)) {
+      tern_rem_lits++;
+      continue;
+    }
+
+    // restore the values
+    for (size_t j=Changed.size(); j > 0; j--)
+      Tern_vals[Changed[j-1].first] = Changed[j-1].second;
+    St_cube.push_back(Cands[i]);
+  }
+
+  return(true);
+
+} /* end of function tern_lift */
@@ -33,6 +33,16 @@ public:
  
   int num_circ_vars; // number of variables assigned to gates of N
 
+  // ternary simulation used to lift states
+  CUBE Sim_order; // gates of N that are not inputs or latches, in
+                  // topological order
+  CUBE Sim_pos; // Sim_pos[gate_ind] is the position of gate 'gate_ind'
+                // in 'Sim_order' or -1 for inputs and latches
+  CUBE Var_to_gate; // Var_to_gate[var] gives the gate whose output is
+                    // assigned variable 'var'
+  CCUBE Tern_vals; // values of gates: 0, 1 or TERN_X
+  CCUBE Tern_targets; // marks the gates whose value has to stay known
+
   CUBE Pres_svars; // array specifying the current state variables
   CUBE Next_svars; // array specifying the next state variables
   DNF Coi_svars; // Coi_svars[i] spec. the vars that are in the cone influence
@@ -153,6 +163,14 @@ public:
 
   int inv_ind; // specifies the index of F_i that is an invariant
                // if no invariant is found, inv_ind is equal to -1
+
+  CNF Lemmas; // clauses that hold in all reachable states, e.g. the
+              // invariants of properties proved earlier. They are
+              // added to F_1 before the first time frame is processed
+
+  CNF Inv_cands; // clauses of an invariant found in an earlier run. The
+                 // ones that still hold in all reachable states are
+                 // added to 'Lemmas'
  
   // picking literals
   float multiplier; // used to increase the value of factor
@@ -164,6 +182,12 @@ public:
 
  // --------------- Parameters controlling algorithm's behavior
 
+  int num_threads; // number of threads used to push clauses forward
+  size_t min_par_push; // min. number of clauses for pushing
+                       // clauses forward in parallel
+  bool single_solver; // if true, time frames 1,2,.. share one SAT-solver
+                      // where the clauses of a time frame are enabled
+                      // by an activation literal
   bool standard_mode; // if true, the algorithm simulates Bradley's version
                       // of ic3 published in 2013
   
@@ -198,6 +222,8 @@ public:
   int sorted_objects; // specifies whether literals or variables are sorted
   int lift_sort_mode; // value of this variable controls how assumptions 
                       // are sorted when lifting a state
+  int lift_mode; // specifies whether states are lifted by SAT-checks,
+                 // by ternary simulation or by both
   int ind_cls_sort_mode; // value of this variable controls how assumptions 
                          // are sorted when looking for an inductive clause
   int gate_sort_mode; // value of this variable controls the ordering of
@@ -228,7 +254,11 @@ public:
   //
 
   int run_ic3();
+  int run_inv_check(CNF &H);
   int mic3();
+  void form_inv_clauses(CNF &H);
+  void delete_tf_solvers();
+  void release_memory();
   void init_parameters();
   void print_header();
   void blif_format_model(char *fname); 
@@ -277,6 +307,10 @@ protected:
   int num_gstate_cubes; // number of times a good state has been lifted
   float length_gstate_cubes; // number of length of the good state cubes
                              //  after lifting
+  long num_tern_lifts; // number of times ternary simulation was used
+                       // to lift a state
+  long tern_rem_lits; // number of literals removed by ternary simulation
+  long sat_rem_lits; // number of literals removed by SAT-based lifting
   long new_state_cnt; // counts the number of new states that appeared 
                       // in the obligation table
   long old_state_cnt; // counts the number of old states that appeared 
@@ -298,6 +332,8 @@ protected:
   int max_num_impr; // specifies the maximum number of improvements for an
                       // inductive clause
   int num_push_clause_calls; // contains the number of sat calls to push clauses
+  int num_par_push_calls; // the part of 'num_push_clause_calls' made
+                          // in parallel threads
   int num_inact_cls; // specifies the number of clauses of F that are currently
                      //  inactive
   int num_add1_cases; // number of cases where 'replce_or_add_clause' returned 
@@ -319,6 +355,10 @@ protected:
   SatSolver Lbs_sat; // A sat-solver used for lifting a bad state
   SatSolver Lgs_sat; // A sat-solver used for lifting a good state
   SatSolver Dbg_sat; // A sat-solver used for debugging
+  SatSolver Tf_sat; // A sat-solver shared by time frames 1,2,.. if
+                    // 'single_solver' is true
+  std::vector <IctMinisat::Solver *> Push_slvrs; // SAT-solvers of the threads
+                                                // pushing clauses forward
 
   NameTable Name_table; // Table with the names of Sat-solvers for
                         //  which 'init_sat_solver' were invoked
@@ -390,6 +430,14 @@ const int NO_SORT = 0;
 const int FULL_SORT = 1;
 const int PART_SORT = 2;
 
+// values of 'lift_mode'
+const int SAT_LIFT = 0;
+const int TERN_LIFT = 1;
+const int MIXED_LIFT = 2; // ternary simulation followed by SAT-checks
+
+// unknown value in ternary simulation
+const char TERN_X = 2;
+
 // values of 'gate_sort_mode'
 const int INIT_SORT = 0;
 const int INPS_FIRST = 1;
@@ -412,3 +460,5 @@ const int WITH_JOINS = 1;
 
 const int  MAX_MARKER = 1000000; // used in hash tables
 
+const size_t MIN_PAR_PUSH = 64; // default value of 'min_par_push'
+
@@ -9,12 +9,13 @@ Author: Eugene Goldberg, eu.goldberg@gmail.com
 // clang-format off
 // The order of these matter.
 #include <util/cmdline.h>
+#include <util/phase_statistics.h>
 #include <util/ui_message.h>
 
 #include <ebmc/ebmc_properties.h>
+#include <ebmc/transition_system.h>
 
 #include <trans-netlist/netlist.h>
-#include <trans-netlist/trans_to_netlist.h>
 
 #include <algorithm>
 #include <iostream>
@@ -63,22 +64,24 @@ int ic3_enginet::operator()()
   read_parameters();
 
   try    {
-    auto transition_system =
+    transition_system =
       get_transition_system(cmdline, message.get_message_handler());
 
     // make net-list
     message.status() << "Generating Netlist" << messaget::eom;
 
-    convert_trans_to_netlist(
-      transition_system.symbol_table,
-      transition_system.main_symbol->name,
-      netlist,
-      message.get_message_handler());
+    {
+      phase_timert timer("netlist");
+      convert_to_netlist(
+        transition_system, netlist, message.get_message_handler());
+    }
 
     message.statistics() << "Latches: " << netlist.var_map.latches.size()
                          << ", nodes: " << netlist.number_of_nodes()
                          << messaget::eom;
 
+    output_strash_statistics(netlist, message);
+
     properties = ebmc_propertiest::from_command_line(
       cmdline, transition_system, message.get_message_handler());
 
@@ -104,19 +107,24 @@ int ic3_enginet::operator()()
   const0 = false;
   const1 = false;
   orig_names = false;
-  
+
+  if (cmdline.isset("check-invariant")) {
+    if (!read_cert(Old_cert,cmdline.get_value("check-invariant"))) return 1;
+  }
+  else if (cmdline.isset("warm-start")) {
+    if (!read_cert(Old_cert,cmdline.get_value("warm-start"))) return 1;
+  }
+
+  if (!cmdline.isset("aiger"))
+    return(check_all_properties());
+
   // print_nodes();
   // print_var_map(std::cout);
   read_ebmc_input();
   // print_blif3("tst.blif",Ci.N);
-  if (cmdline.isset("aiger")) {
-    printf("converting to aiger format\n");
-    Ci.print_aiger_format();
-    exit(0);
-  }
-  
-  //  printf("Constr_gates.size() = %d\n",Ci.Constr_gates.size()); 
-  return(Ci.run_ic3());
+  printf("converting to aiger format\n");
+  Ci.print_aiger_format();
+  exit(0);
 
 } /* end of function operator */
 
@@ -136,7 +144,11 @@ int CompInfo::run_ic3()
   assign_var_type();
   assign_value();
   get_runtime (usrtime0, systime0);
-  int res = mic3();
+  int res;
+  {
+    phase_timert timer("solve");
+    res = mic3();
+  }
   get_runtime (usrtime, systime);  
 
   int ret_val;
@@ -154,12 +166,14 @@ int CompInfo::run_ic3()
       print_invariant(print_only_ind_clauses);
     if (print_clauses_flag)
       print_fclauses();
+    phase_timert timer("solve");
     bool ok = ver_trans_inv();
     if (ok) ret_val = 2;
     else ret_val = 12;
     break;}
   case 1: {
     printf("property FAILED\n");
+    phase_timert timer("trace");
     form_cex();  
     if (print_cex_flag == 1)
       fprint_cex1();
@@ -227,6 +241,7 @@ int CompInfo::mic3()
 
   if (ctg_flag) form_coi_array();
   tf_lind = 1;
+  add_lemmas();
  
 
   init_lbs_sat_solver();
@@ -262,6 +277,7 @@ int CompInfo::mic3()
  FINISH:
   delete_solver(Lbs_sat);
   delete_solver(Lgs_sat);
+  delete_push_solvers();
   return(ret_val);
 
 } /* end of function mic3 */
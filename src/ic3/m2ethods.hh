@@ -15,6 +15,13 @@ void init_bst_sat_solver();
 void init_lbs_sat_solver();
 void init_lgs_sat_solver();
 void add_fclause1(CLAUSE &C,int last_ind,char st_descr);
+void accept_tf_clause(int tf_ind,CLAUSE &C);
+void add_tf_assumps(MvecLits &Assmps,int tf_ind);
+void share_tf_solver(int tf_ind);
+void add_lemmas();
+void filter_inv_cands();
+bool check_inv(CNF &H);
+void add_inv_selectors(SatSolver &Slvr,CNF &H,CLAUSE &Sel_clause);
 void form_conv_tables(char *root);
 void conv_to_pres_state(CUBE &A,CUBE &B);
 void conv_to_next_state(CUBE &A,CUBE &B);
@@ -65,6 +72,11 @@ void lift_good_state(CUBE &Gst_cube,CUBE &Pst,CUBE &Inps,CLAUSE &Nst_cube);
 void extr_next_inps(CUBE &Inps,SatSolver &Slvr);
 void check_overlapping();
 void gen_state_cube(CUBE &St_cube,CUBE &St,SatSolver &Slvr);
+void form_sim_order();
+char tern_eval(int gate_ind);
+char tern_lit_val(int lit);
+bool tern_propagate(int gate_ind,std::vector<std::pair<int,char>> &Changed);
+bool tern_lift(CUBE &St_cube,CUBE &Cands,CUBE &St,CUBE &Inps,CUBE &Targets);
 void form_init_st(CUBE &St_cube);
 void form_missing_nxt_svars();
 void add_time_frame();
@@ -83,6 +95,13 @@ bool subsumes(CLAUSE &C,hsh_tbl &Ht);
 void print_time_frame_sat_stat(int &time_frame_calls);
 void print_all_calls(int time_frame_calls);
 int replace_or_add_clause(int clause_ind,CLAUSE &C,int tf_ind);
+bool use_par_push(int min_tf);
+void init_push_solvers();
+void add_push_clause(CLAUSE &C,int tf_ind);
+void par_push_clauses(std::vector <PushTask> &Tasks,int tf_ind);
+bool take_push_result(CLAUSE &C,PushTask &T);
+void upd_push_solvers();
+void delete_push_solvers();
 void add_fclause2(CLAUSE &C,int last_ind,bool upd_activity);
 void init_fields();
 //
@@ -0,0 +1,308 @@
+/******************************************************
+
+Module: Checking several properties in one run
+
+******************************************************/
+#include <queue>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <iostream>
+
+#include <util/phase_statistics.h>
+
+#include <ebmc/ebmc_base.h>
+#include <ebmc/report_results.h>
+
+#include "minisat/core/Solver.h"
+#include "minisat/simp/SimpSolver.h"
+#include "dnf_io.hh"
+#include "ccircuit.hh"
+#include "m0ic3.hh"
+
+#include "ebmc_ic3_interface.hh"
+
+/*=============================================
+
+   C H E C K _ A L L _ P R O P E R T I E S
+
+  Checks the properties one after another,
+  retiring each property as soon as it is
+  proved or refuted. The clauses of the
+  inductive invariant of a proved property
+  hold in all reachable states. They are
+  passed on to the properties checked later.
+
+  Returns:
+    1 - some property failed
+    2 - all properties hold
+    3 - some property is undecided
+   11 - a counterexample failed verification
+   12 - an invariant failed verification
+
+  ============================================*/
+int ic3_enginet::check_all_properties()
+{
+
+  const netlistt netlist0 = netlist;
+  int ret_val = 2;
+
+  for(auto &Prop : properties.properties) {
+    if (!Prop.is_unknown()) continue;
+
+    if (!supported_prop(Prop)) {
+      Prop.failure("property type not supported by IC3");
+      if (ret_val == 2) ret_val = 3;
+      continue;
+    }
+
+    printf("\nchecking property %s\n",id2string(Prop.name).c_str());
+
+    netlist = netlist0;
+    reset_engine();
+    Ci.prop_name = id2string(Prop.name);
+    {
+      phase_timert timer("properties");
+      read_ebmc_input();
+      form_lemmas();
+    }
+
+    int res;
+    if (cmdline.isset("check-invariant")) {
+      phase_timert timer("solve");
+      res = check_cert(id2string(Prop.name));
+    }
+    else {
+      form_warm_start();
+      res = Ci.run_ic3();
+    }
+
+    switch (res) {
+    case 1:
+      Prop.refuted();
+      if ((ret_val == 2) || (ret_val == 3)) ret_val = 1;
+      break;
+    case 2:
+      Prop.proved();
+      store_lemmas();
+      store_cert(id2string(Prop.name));
+      break;
+    case 3:
+      Prop.inconclusive();
+      if (ret_val == 2) ret_val = 3;
+      break;
+    default:
+      Prop.failure("verification of the result failed");
+      ret_val = res;
+    }
+
+    Ci.release_memory();
+  }
+
+  if (cmdline.isset("write-invariant"))
+    write_cert(New_cert,cmdline.get_value("write-invariant"));
+
+  const namespacet ns(transition_system.symbol_table);
+  report_results(cmdline, properties, ns, message.get_message_handler());
+
+  return(ret_val);
+
+} /* end of function check_all_properties */
+
+/*=================================
+
+    S U P P O R T E D _ P R O P
+
+  Returns 'true' if 'Prop' can be
+  checked by IC3
+
+  ================================*/
+bool ic3_enginet::supported_prop(propertyt &Prop)
+{
+
+  if (Prop.normalized_expr.id() != ID_sva_always)
+    return(false);
+
+  exprt Oper = to_unary_expr(Prop.normalized_expr).op();
+  return(!banned_expr(Oper));
+
+} /* end of function supported_prop */
+
+/*=============================
+
+    R E S E T _ E N G I N E
+
+  Prepares the engine for
+  checking the next property
+
+  ===========================*/
+void ic3_enginet::reset_engine()
+{
+
+  Ci = CompInfo();
+  Ci.init_parameters();
+  read_parameters();
+
+  Gn.clear();
+  Latch_val.clear();
+  Nondet_vars.clear();
+  const0 = false;
+  const1 = false;
+
+} /* end of function reset_engine */
+
+/*=============================
+
+    S T O R E _ L E M M A S
+
+  Adds the clauses of the
+  invariant just found to
+  'Lemmas'
+
+  ===========================*/
+void ic3_enginet::store_lemmas()
+{
+
+  Circuit *N = Ci.N;
+  std::map<int,CCUBE> Var_names;
+
+  for (size_t i=0; i < N->Gate_list.size(); i++) {
+    Gate &G = N->get_gate(i);
+    if (G.gate_type != LATCH) continue;
+    Var_names[Ci.Gate_to_var[i]] = G.Gate_name;
+  }
+
+  CNF H;
+  Ci.form_inv_clauses(H);
+
+  for (size_t i=0; i < H.size(); i++) {
+    NamedClause C;
+    for (size_t j=0; j < H[i].size(); j++) {
+      int lit = H[i][j];
+      auto pnt = Var_names.find(abs(lit));
+      if (pnt == Var_names.end()) break;
+      C.push_back(NamedLit(pnt->second,lit < 0));
+    }
+    if (C.size() < H[i].size()) continue;
+    std::sort(C.begin(),C.end());
+    Lemmas.insert(C);
+  }
+
+} /* end of function store_lemmas */
+
+/*=============================
+
+    F O R M _ L E M M A S
+
+  Converts 'Lemmas' into 
+  clauses over the present
+  state variables of the
+  current circuit
+
+  ===========================*/
+void ic3_enginet::form_lemmas()
+{
+
+  Circuit *N = Ci.N;
+  std::map<CCUBE,int> Latch_vars;
+
+  for (size_t i=0; i < N->Gate_list.size(); i++) {
+    Gate &G = N->get_gate(i);
+    if (G.gate_type != LATCH) continue;
+    Latch_vars[G.Gate_name] = Ci.Gate_to_var[i];
+  }
+
+  Ci.Lemmas.clear();
+
+  for (auto &Nc : Lemmas) {
+    CLAUSE C;
+    for (auto &lit : Nc) {
+      auto pnt = Latch_vars.find(lit.first);
+      if (pnt == Latch_vars.end()) break;
+      C.push_back(lit.second ? -pnt->second : pnt->second);
+    }
+    if (C.size() < Nc.size()) continue;
+    Ci.Lemmas.push_back(C);
+  }
+
+} /* end of function form_lemmas */
+
+/*=============================
+
+    A D D _ L E M M A S
+
+  ===========================*/
+void CompInfo::add_lemmas()
+{
+
+  if (Inv_cands.size() > 0) filter_inv_cands();
+
+  for (size_t i=0; i < Lemmas.size(); i++) {
+    CLAUSE C = Lemmas[i];
+    add_fclause1(C,1,UNKNOWN_STATE);
+  }
+
+} /* end of function add_lemmas */
+
+/*=====================================
+
+    F O R M _ I N V _ C L A U S E S
+
+  Returns the clauses of the inductive 
+  invariant, if one was found
+
+  ====================================*/
+void CompInfo::form_inv_clauses(CNF &H)
+{
+
+  if (vac_true || (inv_ind < 0)) return;
+  gen_form1(H,inv_ind+1);
+
+} /* end of function form_inv_clauses */
+
+/*=====================================
+
+    D E L E T E _ T F _ S O L V E R S
+
+  ====================================*/
+void CompInfo::delete_tf_solvers()
+{
+
+  if (single_solver) {
+    if (Time_frames.size() > 0) delete_solver(Time_frames[0].Slvr);
+    if (Time_frames.size() > 1) delete_solver(Tf_sat);
+    return;
+  }
+
+  for (size_t i=0; i < Time_frames.size(); i++)
+    delete_solver(Time_frames[i].Slvr);
+
+} /* end of function delete_tf_solvers */
+
+/*=====================================
+
+    R E L E A S E _ M E M O R Y
+
+  Deletes the circuit and the SAT-solvers
+  built for the property just checked.
+  Solvers that were never initialized
+  or are already deleted are skipped
+
+  ====================================*/
+void CompInfo::release_memory()
+{
+
+  delete_tf_solvers();
+  delete_push_solvers();
+
+  SatSolver *Slvrs[] = {&Gen_sat,&Bst_sat,&Lbs_sat,&Lgs_sat};
+  for (SatSolver *S : Slvrs) {
+    if (Name_table.find(S->Name) == Name_table.end()) continue;
+    if (S->prev_oper == DELETE) continue;
+    delete_solver(*S);
+  }
+
+  delete_circuit(N);
+  N = 0;
+
+} /* end of function release_memory */
@@ -45,6 +45,30 @@ void ic3_enginet::read_parameters()
 
   if (cmdline.isset("new-mode"))
     Ci.standard_mode = false;
+
+  if (cmdline.isset("single-solver"))
+    Ci.single_solver = true;
+
+  if (cmdline.isset("lifting")) {
+    std::string Mode = cmdline.get_value("lifting");
+    if (Mode == "sat") Ci.lift_mode = SAT_LIFT;
+    else if (Mode == "ternary") Ci.lift_mode = TERN_LIFT;
+    else if (Mode == "mixed") Ci.lift_mode = MIXED_LIFT;
+    else {
+      printf("wrong lifting mode %s\n",Mode.c_str());
+      exit(1);
+    }
+  }
+
+  if (cmdline.isset("push-threads")) {
+    int num = atoi(cmdline.get_value("push-threads").c_str());
+    Ci.num_threads = std::max(1,num);
+  }
+
+  if (cmdline.isset("min-par-push")) {
+    int num = atoi(cmdline.get_value("min-par-push").c_str());
+    Ci.min_par_push = std::max(0,num);
+  }
 } /* end of function read_parameters */
 
 /*==============================
@@ -55,9 +79,21 @@ void ic3_enginet::read_parameters()
 void ic3_enginet::print_header()
 {
 
-  printf("ebmc verilog_file --ic3 [--prop nm] [--constr]\n");
+  printf("ebmc verilog_file --ic3 [--prop nm] [--constr] [--single-solver]\n");
+  printf("       [--write-invariant file] [--check-invariant file] [--warm-start file]\n");
+  printf("       [--lifting sat|ternary|mixed] [--push-threads n] [--min-par-push n]\n");
   printf("prop nm - check property with name 'nm'\n");
   printf("constr  - use constraints listed in 'verilog_file.cnstr'\n");
+  printf("single-solver - use one SAT-solver for all time frames\n");
+  printf("write-invariant file - write the invariants found to 'file'\n");
+  printf("check-invariant file - check the invariants in 'file' instead of running IC3\n");
+  printf("warm-start file - add the clauses of the invariants in 'file' that still hold\n");
+  printf("lifting sat - lift states by SAT-checks (default)\n");
+  printf("lifting ternary - lift states by ternary simulation\n");
+  printf("lifting mixed - ternary simulation followed by SAT-checks\n");
+  printf("push-threads n - push clauses forward in 'n' threads\n");
+  printf("min-par-push n - use the threads only if at least 'n' clauses\n");
+  printf("                 are to be pushed (default: %d)\n",(int) MIN_PAR_PUSH);
 } /* end of function print_header */
 
 /*=====================================
@@ -86,6 +122,7 @@ void CompInfo::init_parameters()
   act_upd_mode = MINISAT_ACT_UPD;
   sorted_objects = VARS;
   lift_sort_mode = FULL_SORT;
+  lift_mode = SAT_LIFT;
   ind_cls_sort_mode = FULL_SORT;
   gate_sort_mode = INPS_FIRST;
   multiplier = 1.05;
@@ -98,6 +135,9 @@ void CompInfo::init_parameters()
   max_coi_depth = 10;
   constr_flag = false;
   standard_mode = true;
+  single_solver = false;
+  num_threads = 1;
+  min_par_push = MIN_PAR_PUSH;
   
   } /* end of function init_parameters */
 
@@ -34,9 +34,22 @@ void CompInfo::push_clauses_forward(bool triv_time_frame)
   init_fields();
 
   if (triv_time_frame) min_tf = tf_lind;
+
+  bool par_push = use_par_push(min_tf);
+  if (par_push) init_push_solvers();
+
   for (size_t i=min_tf; i <= (size_t) tf_lind; i++) { 
     CUBE Pushed;
     CUBE &Clauses = Time_frames[i].Clauses;
+
+    std::vector <PushTask> Tasks;
+    std::map <int,size_t> Task_inds;
+    if (par_push) {
+      par_push_clauses(Tasks,i);
+      for (size_t j=0; j < Tasks.size(); j++)
+        Task_inds[Tasks[j].clause_ind] = j;
+    }
+
     for (size_t j=0; j  < Clauses.size();j++) { 
       int clause_ind = Clauses[j];
       if (Clause_info[clause_ind].active == 0) continue;
@@ -45,7 +58,10 @@ void CompInfo::push_clauses_forward(bool triv_time_frame)
 
       CLAUSE C;
      
-      bool ok = push_clause(C,i,clause_ind);
+      bool ok;
+      auto pnt = Task_inds.find(clause_ind);
+      if (pnt != Task_inds.end()) ok = take_push_result(C,Tasks[pnt->second]);
+      else ok = push_clause(C,i,clause_ind);
       if (!ok) {
 	Clause_info[clause_ind].skip = 1;
 	continue;
@@ -88,7 +104,12 @@ void CompInfo::push_clauses_forward(bool triv_time_frame)
     } /* for j */
     
 
-    add_new_clauses(Time_frames[i+1].Slvr,Pushed);
+    if (single_solver)
+      for (size_t j=0; j < Pushed.size(); j++)
+        accept_tf_clause(i+1,F[Pushed[j]]);
+    else add_new_clauses(Time_frames[i+1].Slvr,Pushed);
+
+    if (par_push) upd_push_solvers();
 
     if (Time_frames[i].num_bnd_cls == 0) {
       inv_ind = i;
@@ -96,7 +117,7 @@ void CompInfo::push_clauses_forward(bool triv_time_frame)
       break;}
    
   }
- 
+
 } /* end of function push_clauses_forward */
 
 
@@ -191,6 +212,7 @@ int CompInfo::replace_or_add_clause(int clause_ind,CLAUSE &C,int tf_ind)
   Clause_table.erase(pnt2);
  
   F[clause_ind] = C;
+  Clause_info[clause_ind].push_span = 0;
 
   if (clause_ind1 == -1) {
     Clause_table[C] = clause_ind;   
@@ -25,6 +25,11 @@ Author: Eugene Goldberg, eu.goldberg@gmail.com
 void CompInfo::simplify_tf_solvers()
 {
 
+  if (single_solver) {
+    if (Time_frames.size() > 1) Tf_sat.Mst->simplify();
+    return;
+  }
+
   for (size_t i=1; i < Time_frames.size(); i++)
     Time_frames[i].Slvr.Mst->simplify();
 
@@ -41,6 +46,11 @@ void CompInfo::simplify_tf_solvers()
 void CompInfo::add_copies(int tf_ind,CLAUSE &C)
 {
 
+  if (single_solver) {
+    if (tf_ind > 0) accept_tf_clause(tf_ind,C);
+    return;
+  }
+
   for (int i=tf_ind; i > 0; i--) 
     add_one_copy(i,C);
   
@@ -57,7 +67,8 @@ void CompInfo::add_copies(int tf_ind,CLAUSE &C)
 void CompInfo::add_one_copy(int tf_ind,CLAUSE &C)
 {
 
-  accept_new_clause(Time_frames[tf_ind].Slvr,C);
+  if (single_solver) accept_tf_clause(tf_ind,C);
+  else accept_new_clause(Time_frames[tf_ind].Slvr,C);
   
 
 } /* end of function add_one_copy */
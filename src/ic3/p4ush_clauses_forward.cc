@@ -0,0 +1,234 @@
+/******************************************************
+
+Module: Pushing clauses to later time frames (Part 3)
+        Checking clauses in parallel
+
+******************************************************/
+#include <queue>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include "minisat/core/Solver.h"
+#include "minisat/simp/SimpSolver.h"
+#include "dnf_io.hh"
+#include "ccircuit.hh"
+#include "m0ic3.hh"
+
+/*==================================
+
+     U S E _ P A R _ P U S H
+
+  Returns 'true' if clauses are to
+  be pushed forward in parallel
+
+  =================================*/
+bool CompInfo::use_par_push(int min_tf)
+{
+
+  if (num_threads < 2) return(false);
+
+  size_t num_cands = 0;
+  for (size_t i=0; i < F.size(); i++) {
+    if (Clause_info[i].active == 0) continue;
+    if (Clause_info[i].span < (size_t) min_tf) continue;
+    if (Clause_info[i].span > (size_t) tf_lind) continue;
+    num_cands++;
+  }
+
+  return(num_cands >= min_par_push);
+
+} /* end of function use_par_push */
+
+/*==============================================
+
+    I N I T _ P U S H _ S O L V E R S
+
+  Creates a SAT-solver for every thread, unless
+  an earlier call did. Every solver holds
+  'Simp_PrTr' and the clauses of F. A clause
+  with span 'k' is enabled by the activation
+  variable of time frame 'k', which is
+  IctMinisat variable 'max_num_vars0+k'. The
+  solvers are kept until IC3 finishes
+
+  =============================================*/
+void CompInfo::init_push_solvers()
+{
+
+  if (Push_slvrs.size() == 0)
+    for (int t=0; t < num_threads; t++) {
+      IctMinisat::Solver *S = new IctMinisat::Solver();
+      for (size_t i=0; i < max_num_vars0; i++)
+        UNUSED IctMinisat::Var nv = S->newVar();
+
+      for (size_t i=0; i < Simp_PrTr.size(); i++) {
+        TrivMclause A;
+        conv_to_mclause(A,Simp_PrTr[i]);
+        S->addClause(A);
+      }
+
+      Push_slvrs.push_back(S);
+    }
+
+  upd_push_solvers();
+
+} /* end of function init_push_solvers */
+
+/*=====================================
+
+    A D D _ P U S H _ C L A U S E
+
+  Adds clause C to time frames 1,..,
+  tf_ind of the SAT-solvers of the
+  threads
+
+  ===================================*/
+void CompInfo::add_push_clause(CLAUSE &C,int tf_ind)
+{
+
+  TrivMclause A;
+  conv_to_mclause(A,C);
+  A.push(IctMinisat::mkLit(max_num_vars0+tf_ind,true));
+
+  for (size_t t=0; t < Push_slvrs.size(); t++)
+    Push_slvrs[t]->addClause(A);
+
+} /* end of function add_push_clause */
+
+/*============================================
+
+    P A R _ P U S H _ C L A U S E S
+
+  Checks which clauses of time frame 'tf_ind'
+  can be pushed to time frame 'tf_ind+1'.
+  The checks are distributed over the threads
+  on demand. The SAT-solvers of the threads
+  are not changed while the checks run. So
+  they may miss clauses added to F_tf_ind
+  while the results are merged. This only
+  makes the checks weaker.
+
+  ===========================================*/
+void CompInfo::par_push_clauses(std::vector <PushTask> &Tasks,int tf_ind)
+{
+
+  CUBE &Clauses = Time_frames[tf_ind].Clauses;
+
+  for (size_t j=0; j < Clauses.size(); j++) {
+    int clause_ind = Clauses[j];
+    if (Clause_info[clause_ind].active == 0) continue;
+    if (Clause_info[clause_ind].skip) continue;
+    if (Clause_info[clause_ind].span != (size_t) tf_ind) continue;
+    PushTask T;
+    T.clause_ind = clause_ind;
+    T.unsat = false;
+    MvecLits Assmps;
+    add_negated_assumps2(Assmps,F[clause_ind],true);
+    for (int k=0; k < Assmps.size(); k++)
+      T.Assmps.push_back(Assmps[k]);
+    Tasks.push_back(T);
+  }
+
+  std::atomic <size_t> next_task(0);
+  int first_act_var = max_num_vars0 + tf_ind;
+  int last_act_var = max_num_vars0 + Time_frames.size() - 1;
+
+  auto worker = [&](IctMinisat::Solver *S) {
+    while (true) {
+      size_t k = next_task++;
+      if (k >= Tasks.size()) break;
+      PushTask &T = Tasks[k];
+
+      MvecLits Assmps;
+      for (size_t i=0; i < T.Assmps.size(); i++)
+        Assmps.push(T.Assmps[i]);
+      for (int var = first_act_var; var <= last_act_var; var++)
+        Assmps.push(IctMinisat::mkLit(var,false));
+
+      T.unsat = !S->solve(Assmps);
+      if (!T.unsat) continue;
+
+      for (size_t i=0; i < T.Assmps.size(); i++) {
+        Mlit L = ~T.Assmps[i];
+        if (S->conflict.has(L)) T.C0.push_back(mlit_to_lit(S,L));
+      }
+    }
+  };
+
+  std::vector <std::thread> Threads;
+  for (size_t t=0; t < Push_slvrs.size(); t++)
+    Threads.emplace_back(worker,Push_slvrs[t]);
+
+  for (size_t t=0; t < Threads.size(); t++)
+    Threads[t].join();
+
+  num_push_clause_calls += Tasks.size();
+  num_par_push_calls += Tasks.size();
+
+} /* end of function par_push_clauses */
+
+/*=====================================
+
+    T A K E _ P U S H _ R E S U L T
+
+  Same as 'push_clause' for a clause
+  checked by 'par_push_clauses'
+
+  ===================================*/
+bool CompInfo::take_push_result(CLAUSE &C,PushTask &T)
+{
+
+  if (!T.unsat) return(false);
+
+  conv_to_pres_state(C,T.C0);
+  if (!corr_clause(C)) modif_ind_clause(C,F[T.clause_ind]);
+  return(true);
+
+} /* end of function take_push_result */
+
+/*=======================================
+
+    U P D _ P U S H _ S O L V E R S
+
+  Adds an activation variable for every
+  new time frame and every clause of F
+  whose span grew since it was last added
+  to the SAT-solvers of the threads. The
+  clauses added earlier with a smaller
+  span are implied by F, so they are kept
+
+  ======================================*/
+void CompInfo::upd_push_solvers()
+{
+
+  int num_vars = (int) (max_num_vars0 + Time_frames.size());
+  for (size_t t=0; t < Push_slvrs.size(); t++)
+    while (Push_slvrs[t]->nVars() < num_vars)
+      UNUSED IctMinisat::Var nv = Push_slvrs[t]->newVar();
+
+  for (size_t i=0; i < F.size(); i++) {
+    if (Clause_info[i].active == 0) continue;
+    if (Clause_info[i].span <= Clause_info[i].push_span) continue;
+    add_push_clause(F[i],Clause_info[i].span);
+    Clause_info[i].push_span = Clause_info[i].span;
+  }
+
+} /* end of function upd_push_solvers */
+
+/*=========================================
+
+    D E L E T E _ P U S H _ S O L V E R S
+
+  ========================================*/
+void CompInfo::delete_push_solvers()
+{
+
+  for (size_t t=0; t < Push_slvrs.size(); t++)
+    delete Push_slvrs[t];
+
+  Push_slvrs.clear();
+
+} /* end of function delete_push_solvers */
@@ -97,8 +97,8 @@ bool ic3_enginet::find_prop(propertyt &Prop)
   }
 
   for(const auto &p : properties.properties)
-    if (p.status==propertyt::statust::UNKNOWN) {
-      assert(p.name == Ci.prop_name);
+    if ((p.status==propertyt::statust::UNKNOWN) &&
+        (p.name == Ci.prop_name)) {
       Prop = p;
       return(true);
     }
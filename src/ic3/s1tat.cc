@@ -52,6 +52,8 @@ void CompInfo::print_stat()
   printf("muliplier = %.2f\n",multiplier);
 
   print_lifting_stat();
+  printf("#tern. lifts = %ld, lits removed by tern. sim. = %ld, by SAT = %ld\n",
+         num_tern_lifts,tern_rem_lits,sat_rem_lits);
   my_printf("root_state_cnt = %m, new_state_cnt = %m, old_state_cnt = %m",
             root_state_cnt,new_state_cnt,old_state_cnt);
   my_printf(" (triv = %m, rem = %m)\n",triv_old_st_cnt,
@@ -179,6 +181,8 @@ void CompInfo::print_time_frame_sat_stat(int &time_frame_calls)
 
   my_printf("Time frame SAT-solvers: %m calls\n",time_frame_calls); 
   my_printf("Push clause SAT-solving: %m calls\n",num_push_clause_calls);
+  my_printf("Push clause SAT-solving in parallel: %m calls\n",
+            num_par_push_calls);
 
 } /* end of function print_time_frame_sat_stat */
 
@@ -94,6 +94,21 @@ void CompInfo::print_flags()
   else assert(false);
 
   print_induct_lift_sort_mode("lift_sort_mode",lift_sort_mode);
+
+  printf("lift_mode = ");
+  switch (lift_mode) {
+  case SAT_LIFT:
+    printf("SAT_LIFT\n");
+    break;
+  case TERN_LIFT:
+    printf("TERN_LIFT\n");
+    break;
+  case MIXED_LIFT:
+    printf("MIXED_LIFT\n");
+    break;
+  default:
+    assert(false);
+  }
  
   print_induct_lift_sort_mode("ind_cls_sort_mode",ind_cls_sort_mode);
 
@@ -7,6 +7,7 @@ void  assign_levels_from_outputs(Circuit *N);
 void  print_names(FILE *fp,Circuit *N,CUBE &gates);
 void print_name(CCUBE *name);
 Circuit *create_circuit(void);
+void delete_circuit(Circuit *N);
 void init_gate_fields(Gate &G);
 int assign_output_pin_number(std::map<CCUBE,int> &pin_list,CCUBE &name,GCUBE &gate_list,bool latch);
 int assign_input_pin_number1(std::map<CCUBE,int> &pin_list,CCUBE &name,GCUBE &gate_list);
@@ -55,6 +55,7 @@ void CompInfo::add_fclause1(CLAUSE &C,int last_ind,char st_descr)
   el.span = last_ind;
   el.active = 1;
   el.skip = 0;
+  el.push_span = 0;
 
   Clause_info.push_back(el);
   
@@ -78,12 +79,34 @@ void CompInfo::add_fclause1(CLAUSE &C,int last_ind,char st_descr)
     clause_ind = clause_ind1;
   }
   for (int i=start_ind; i <= last_ind; i++) {
-    accept_new_clause(Time_frames[i].Slvr,C);
+    if (!single_solver) accept_new_clause(Time_frames[i].Slvr,C);
     Time_frames[i].Clauses.push_back(clause_ind);
   }
 
+  if (single_solver && (start_ind <= last_ind))
+    accept_tf_clause(last_ind,C);
+
 } /* end of function add_fclause1 */
 
+/*=========================================
+
+       A C C E P T _ T F _ C L A U S E
+
+  Adds clause C to time frames 1,..,tf_ind
+  of the shared SAT-solver 'Tf_sat'
+
+  ========================================*/
+void CompInfo::accept_tf_clause(int tf_ind,CLAUSE &C)
+{
+
+  assert(single_solver && (tf_ind > 0));
+  TrivMclause A;
+  conv_to_mclause(A,C);
+  A.push(IctMinisat::mkLit(Time_frames[tf_ind].act_var,true));
+  Tf_sat.Mst->addClause(A);
+
+} /* end of function accept_tf_clause */
+
 
 /*=========================================
 
@@ -63,6 +63,24 @@ void CompInfo::add_negated_assumps1(MvecLits &Assmps,CLAUSE &C)
     
 } /* end of function add_negated_assumps1 */
 
+/*============================================
+
+     A D D _ T F _ A S S U M P S
+
+  Enables the clauses of time frame 'tf_ind'
+  of the shared SAT-solver 'Tf_sat'. These
+  are the clauses added to time frames
+  tf_ind,tf_ind+1,...
+
+  ==========================================*/
+void CompInfo::add_tf_assumps(MvecLits &Assmps,int tf_ind)
+{
+
+  for (size_t i=tf_ind; i < Time_frames.size(); i++) 
+    Assmps.push(IctMinisat::mkLit(Time_frames[i].act_var,false));
+
+} /* end of function add_tf_assumps */
+
 /*=================================
 
       R E L E A S E _ L I T 
@@ -11,6 +11,48 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cassert>
 #include <ostream>
 #include <string>
+#include <utility>
+
+literalt aigt::new_and_node_strash(literalt a, literalt b) {
+  // constant propagation
+  if (a.is_false() || b.is_false()) {
+    avoided_and_nodes++;
+    return const_literal(false);
+  }
+  if (a.is_true()) {
+    avoided_and_nodes++;
+    return b;
+  }
+  if (b.is_true()) {
+    avoided_and_nodes++;
+    return a;
+  }
+
+  // idempotence and contradiction
+  if (a == b) {
+    avoided_and_nodes++;
+    return a;
+  }
+  if (a == !b) {
+    avoided_and_nodes++;
+    return const_literal(false);
+  }
+
+  // canonical fanin order
+  if (b < a)
+    std::swap(a, b);
+
+  auto result = and_node_table.emplace(std::make_pair(a, b), literalt());
+
+  if (!result.second) {
+    avoided_and_nodes++;
+    return result.first->second;
+  }
+
+  literalt l = new_and_node(a, b);
+  result.first->second = l;
+  return l;
+}
 
 std::string aigt::label(nodest::size_type v) const {
   return "var(" + std::to_string(v) + ")";
@@ -14,6 +14,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <solvers/prop/literal.h>
@@ -46,7 +47,11 @@ public:
   typedef std::vector<nodet> nodest;
   nodest nodes;
 
-  void clear() { nodes.clear(); }
+  void clear() {
+    nodes.clear();
+    and_node_table.clear();
+    avoided_and_nodes = 0;
+  }
 
   const aig_nodet &get_node(literalt l) const { return nodes[l.var_no()]; }
 
@@ -54,7 +59,11 @@ public:
 
   nodest::size_type number_of_nodes() const { return nodes.size(); }
 
-  void swap(aigt &g) { nodes.swap(g.nodes); }
+  void swap(aigt &g) {
+    nodes.swap(g.nodes);
+    and_node_table.swap(g.and_node_table);
+    std::swap(avoided_and_nodes, g.avoided_and_nodes);
+  }
 
   literalt new_node() {
     nodes.push_back(aig_nodet());
@@ -75,6 +84,14 @@ public:
     return l;
   }
 
+  // Structurally hashed AND: folds constants, a&a and a&!a,
+  // and returns an existing node for the same (ordered) fanins.
+  literalt new_and_node_strash(literalt a, literalt b);
+
+  // number of AND requests answered without a new node, by folding
+  // or by an existing node
+  std::size_t number_of_avoided_and_nodes() const { return avoided_and_nodes; }
+
   bool empty() const { return nodes.empty(); }
 
   void print(std::ostream &out) const;
@@ -86,6 +103,22 @@ public:
 
   std::string label(nodest::size_type v) const;
   std::string dot_label(nodest::size_type v) const;
+
+protected:
+  struct and_node_hasht {
+    std::size_t operator()(const std::pair<literalt, literalt> &p) const {
+      return std::hash<literalt::var_not>()(p.first.get()) * 31 ^
+             std::hash<literalt::var_not>()(p.second.get());
+    }
+  };
+
+  // fanin pair -> AND node, for structural hashing
+  typedef std::unordered_map<std::pair<literalt, literalt>, literalt,
+                             and_node_hasht>
+      and_node_tablet;
+  and_node_tablet and_node_table;
+
+  std::size_t avoided_and_nodes = 0;
 };
 
 std::ostream &operator<<(std::ostream &, const aigt &);
@@ -51,17 +51,8 @@ literalt aig_prop_baset::lxor(const bvt &bv) {
 }
 
 literalt aig_prop_baset::land(literalt a, literalt b) {
-  if (a.is_true() || b.is_false())
-    return b;
-  if (b.is_true() || a.is_false())
-    return a;
-
-  if (a == neg(b))
-    return const_literal(false);
-  if (a == b)
-    return a;
-
-  return dest.new_and_node(a, b);
+  // constants, a&a, a&!a and duplicate fanins are handled by the AIG
+  return dest.new_and_node_strash(a, b);
 }
 
 literalt aig_prop_baset::lor(literalt a, literalt b) {
@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <solvers/flattening/boolbv_width.h>
 
 #include "bmc_map.h"
+#include "netlist_coi.h"
 
 /*******************************************************************\
 
@@ -28,6 +29,54 @@ void bmc_mapt::map_timeframes(
   const netlistt &netlist,
   std::size_t no_timeframes,
   propt &solver)
+{
+  map_timeframes_if(
+    netlist, no_timeframes, solver, [](std::size_t, std::size_t) {
+      return true;
+    });
+}
+
+/*******************************************************************\
+
+Function: bmc_mapt::map_timeframes
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bmc_mapt::map_timeframes(
+  const netlistt &netlist,
+  std::size_t no_timeframes,
+  propt &solver,
+  const netlist_coit &coi)
+{
+  map_timeframes_if(
+    netlist, no_timeframes, solver, [&coi](std::size_t t, std::size_t n) {
+      return coi.is_in_coi(t, n);
+    });
+}
+
+/*******************************************************************\
+
+Function: bmc_mapt::map_timeframes_if
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void bmc_mapt::map_timeframes_if(
+  const netlistt &netlist,
+  std::size_t no_timeframes,
+  propt &solver,
+  const std::function<bool(std::size_t, std::size_t)> &predicate)
 {
   var_map=netlist.var_map;
   timeframe_map.resize(no_timeframes);
@@ -39,6 +88,9 @@ void bmc_mapt::map_timeframes(
 
     for(std::size_t n = 0; n < timeframe.size(); n++)
     {
+      if(!predicate(t, n))
+        continue;
+
       literalt solver_literal=solver.new_variable();
       timeframe[n].solver_literal=solver_literal;
 
@@ -52,4 +104,3 @@ void bmc_mapt::map_timeframes(
     }
   }
 }
-
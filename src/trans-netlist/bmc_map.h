@@ -13,6 +13,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "netlist.h"
 
+#include <functional>
+
+class netlist_coit;
+
 class bmc_mapt
 {
 public:
@@ -47,6 +51,12 @@ public:
     return get(timeframe, l.var_no())^l.sign();
   }
 
+  // does the netlist variable have a solver literal?
+  inline bool is_mapped(std::size_t timeframe, unsigned var_no) const
+  {
+    return get(timeframe, var_no).var_no() != literalt::unused_var_no();
+  }
+
   // set the solver literal for a netlist variable
   void set(std::size_t timeframe, unsigned var_no, literalt l)
   {
@@ -62,6 +72,14 @@ public:
     std::size_t no_timeframes,
     propt &solver);
 
+  // as above, but only for the nodes in the given cone of influence;
+  // the remaining nodes do not get a solver literal
+  void map_timeframes(
+    const netlistt &netlist,
+    std::size_t no_timeframes,
+    propt &solver,
+    const netlist_coit &coi);
+
   var_mapt var_map;
 
   struct nodet
@@ -99,6 +117,15 @@ public:
     timeframe_map.clear();
     reverse_map.clear();
   }
+
+protected:
+  // gives a solver literal to the nodes n of timeframe t
+  // for which predicate(t, n) holds
+  void map_timeframes_if(
+    const netlistt &netlist,
+    std::size_t no_timeframes,
+    propt &solver,
+    const std::function<bool(std::size_t, std::size_t)> &predicate);
 };
 
 #endif
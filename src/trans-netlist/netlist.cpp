@@ -8,6 +8,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <ctype.h>
 
+#include <util/message.h>
+
 #include <solvers/flattening/boolbv_width.h>
 
 #include "netlist.h"
@@ -454,3 +456,24 @@ void netlistt::print_smv(
     out << "unknown";
 }
 
+
+/*******************************************************************\
+
+Function: output_strash_statistics
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void output_strash_statistics(const netlistt &netlist, messaget &message)
+{
+  message.statistics() << "AIG nodes before structural hashing: "
+                       << netlist.number_of_nodes() +
+                            netlist.number_of_avoided_and_nodes()
+                       << ", after: " << netlist.number_of_nodes()
+                       << messaget::eom;
+}
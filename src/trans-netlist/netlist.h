@@ -15,6 +15,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iosfwd>
 #include <variant>
 
+class messaget;
+
 class netlistt:public aig_plus_constraintst
 {
 public:
@@ -37,6 +39,7 @@ public:
   virtual void print(std::ostream &out) const;
   virtual void output_dot(std::ostream &out) const;
   virtual void output_smv(std::ostream &out) const;
+  virtual void output_aiger(std::ostream &out) const;
   virtual std::string label(unsigned n) const;
   virtual std::string dot_label(unsigned n) const;
   
@@ -74,4 +77,7 @@ protected:
   void print_smv(std::ostream &out, literalt l) const;
 };
 
+// reports the AND nodes avoided by structural hashing
+void output_strash_statistics(const netlistt &, messaget &);
+
 #endif
@@ -0,0 +1,323 @@
+/*******************************************************************\
+
+Module: Binary AIGER Output of a Netlist
+
+\*******************************************************************/
+
+#include "netlist.h"
+
+#include <algorithm>
+#include <ostream>
+#include <unordered_set>
+
+/*******************************************************************\
+
+Function: write_aiger_delta
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: 7-bit variable-length encoding of the binary AND section
+
+\*******************************************************************/
+
+static void write_aiger_delta(std::streambuf &out, unsigned x)
+{
+  while(x & ~0x7fu)
+  {
+    out.sputc(static_cast<char>((x & 0x7f) | 0x80));
+    x >>= 7;
+  }
+
+  out.sputc(static_cast<char>(x));
+}
+
+/*******************************************************************\
+
+Function: netlistt::output_aiger
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Writes the netlist in binary AIGER 1.9 format.
+          Gp properties become bad-state properties, GFp
+          properties become justice properties.
+
+\*******************************************************************/
+
+void netlistt::output_aiger(std::ostream &out) const
+{
+  // AIGER wants the inputs first, then the latches, then the
+  // AND gates, each in consecutive order.
+  struct latcht
+  {
+    literalt current, next;
+    std::string name;
+  };
+
+  std::vector<latcht> latches;
+  std::vector<bool> is_latch(nodes.size(), false);
+  std::map<std::size_t, std::string> input_names;
+
+  for(auto &[id, var] : var_map.map)
+  {
+    for(std::size_t i = 0; i < var.bits.size(); i++)
+    {
+      std::string name = id2string(id);
+      if(var.bits.size() != 1)
+        name += '[' + std::to_string(i) + ']';
+
+      if(var.is_latch())
+      {
+        latches.push_back({var.bits[i].current, var.bits[i].next, name});
+        is_latch[var.bits[i].current.var_no()] = true;
+      }
+      else if(var.is_input() || var.is_nondet())
+        input_names[var.bits[i].current.var_no()] = name;
+    }
+  }
+
+  std::vector<std::size_t> input_nodes;
+  std::size_t number_of_ands = 0;
+
+  for(std::size_t n = 0; n < nodes.size(); n++)
+  {
+    if(nodes[n].is_and())
+      number_of_ands++;
+    else if(!is_latch[n])
+      input_nodes.push_back(n);
+  }
+
+  // Split the initial-state constraint into conjuncts. Those that
+  // fix a single latch are reset values, the others become
+  // constraints that are only enforced in the first state.
+  std::vector<unsigned> reset(nodes.size(), 2);
+  bvt initial_constraints;
+
+  {
+    std::vector<literalt> stack(initial.begin(), initial.end());
+    std::unordered_set<unsigned> seen;
+
+    while(!stack.empty())
+    {
+      literalt l = stack.back();
+      stack.pop_back();
+
+      if(l.is_true() || !seen.insert(l.get()).second)
+        continue;
+
+      if(!l.is_constant() && !l.sign() && nodes[l.var_no()].is_and())
+      {
+        stack.push_back(nodes[l.var_no()].a);
+        stack.push_back(nodes[l.var_no()].b);
+      }
+      else if(
+        !l.is_constant() && is_latch[l.var_no()] && reset[l.var_no()] == 2)
+      {
+        reset[l.var_no()] = l.sign() ? 0 : 1;
+      }
+      else
+        initial_constraints.push_back(l);
+    }
+  }
+
+  std::vector<literalt> bad_properties, justice_properties;
+  std::vector<irep_idt> bad_names, justice_names;
+
+  for(auto &[id, property] : properties)
+  {
+    if(std::holds_alternative<Gpt>(property))
+    {
+      bad_properties.push_back(!std::get<Gpt>(property).p);
+      bad_names.push_back(id);
+    }
+    else if(std::holds_alternative<GFpt>(property))
+    {
+      justice_properties.push_back(std::get<GFpt>(property).p);
+      justice_names.push_back(id);
+    }
+  }
+
+  // A GFp property is violated by a path on which p eventually
+  // never holds. This is monitored by a nondeterministically set
+  // latch 'waiting' and a latch 'failed' that records p while
+  // waiting; the justice literal is 'waiting and not failed'.
+  const bool need_init_latch = !initial_constraints.empty();
+
+  const std::size_t I = input_nodes.size() + justice_properties.size();
+  const std::size_t L =
+    latches.size() + (need_init_latch ? 1 : 0) + 2 * justice_properties.size();
+
+  std::vector<unsigned> aiger_var(nodes.size(), 0);
+  unsigned next_var = 1;
+
+  for(auto n : input_nodes)
+    aiger_var[n] = next_var++;
+
+  const unsigned first_extra_input = next_var;
+  next_var += justice_properties.size();
+
+  for(auto &latch : latches)
+    aiger_var[latch.current.var_no()] = next_var++;
+
+  const unsigned first_extra_latch = next_var;
+  next_var += L - latches.size();
+
+  for(std::size_t n = 0; n < nodes.size(); n++)
+    if(nodes[n].is_and())
+      aiger_var[n] = next_var++;
+
+  auto aiger_literal = [&aiger_var](literalt l) -> unsigned {
+    if(l.is_constant())
+      return l.is_true() ? 1 : 0;
+    else
+      return 2 * aiger_var[l.var_no()] + (l.sign() ? 1 : 0);
+  };
+
+  // the additional AND gates, after the ones of the netlist
+  struct and_gatet
+  {
+    unsigned rhs0, rhs1;
+  };
+
+  std::vector<and_gatet> extra_ands;
+
+  auto new_and = [&extra_ands, &next_var](unsigned a, unsigned b) {
+    extra_ands.push_back({std::max(a, b), std::min(a, b)});
+    return 2 * next_var++;
+  };
+
+  struct extra_latcht
+  {
+    unsigned next, reset;
+  };
+
+  std::vector<extra_latcht> extra_latches;
+  std::vector<unsigned> constraint_literals;
+
+  for(auto c : constraints)
+    constraint_literals.push_back(aiger_literal(c));
+
+  for(auto c : transition)
+    constraint_literals.push_back(aiger_literal(c));
+
+  unsigned extra_latch_var = first_extra_latch;
+
+  if(need_init_latch)
+  {
+    // 'initialized' is false in the first state only
+    unsigned initialized = 2 * extra_latch_var++;
+    extra_latches.push_back({1, 0});
+
+    for(auto c : initial_constraints)
+    {
+      // initialized | c
+      constraint_literals.push_back(
+        new_and(initialized ^ 1, aiger_literal(c) ^ 1) ^ 1);
+    }
+  }
+
+  std::vector<unsigned> justice_literals;
+
+  for(std::size_t i = 0; i < justice_properties.size(); i++)
+  {
+    unsigned start = 2 * (first_extra_input + i);
+    unsigned waiting = 2 * extra_latch_var++;
+    unsigned failed = 2 * extra_latch_var++;
+    unsigned p = aiger_literal(justice_properties[i]);
+
+    // waiting' = waiting | start
+    extra_latches.push_back({new_and(waiting ^ 1, start ^ 1) ^ 1, 0});
+
+    // failed' = failed | (waiting & p)
+    unsigned waiting_and_p = new_and(waiting, p);
+    extra_latches.push_back({new_and(failed ^ 1, waiting_and_p ^ 1) ^ 1, 0});
+
+    justice_literals.push_back(new_and(waiting, failed ^ 1));
+  }
+
+  const std::size_t A = number_of_ands + extra_ands.size();
+  const std::size_t M = I + L + A;
+
+  // header
+  out << "aig " << M << ' ' << I << ' ' << L << ' ' << 0 << ' ' << A << ' '
+      << bad_properties.size() << ' ' << constraint_literals.size() << ' '
+      << justice_literals.size() << ' ' << 0 << '\n';
+
+  // latches, with reset value
+  for(auto &latch : latches)
+  {
+    out << aiger_literal(latch.next);
+
+    auto r = reset[latch.current.var_no()];
+    if(r == 1)
+      out << " 1";
+    else if(r == 2) // uninitialized
+      out << ' ' << aiger_literal(latch.current);
+
+    out << '\n';
+  }
+
+  for(auto &latch : extra_latches)
+  {
+    out << latch.next;
+    if(latch.reset != 0)
+      out << ' ' << latch.reset;
+    out << '\n';
+  }
+
+  for(auto b : bad_properties)
+    out << aiger_literal(b) << '\n';
+
+  for(auto c : constraint_literals)
+    out << c << '\n';
+
+  for(std::size_t i = 0; i < justice_literals.size(); i++)
+    out << 1 << '\n';
+
+  for(auto j : justice_literals)
+    out << j << '\n';
+
+  // The AND gates, delta encoded. These are streamed directly
+  // into the buffer of the output stream.
+  std::streambuf &buf = *out.rdbuf();
+  unsigned lhs = 2 * (I + L);
+
+  for(auto &node : nodes)
+  {
+    if(!node.is_and())
+      continue;
+
+    lhs += 2;
+    unsigned a = aiger_literal(node.a), b = aiger_literal(node.b);
+    unsigned rhs0 = std::max(a, b), rhs1 = std::min(a, b);
+    write_aiger_delta(buf, lhs - rhs0);
+    write_aiger_delta(buf, rhs0 - rhs1);
+  }
+
+  for(auto &gate : extra_ands)
+  {
+    lhs += 2;
+    write_aiger_delta(buf, lhs - gate.rhs0);
+    write_aiger_delta(buf, gate.rhs0 - gate.rhs1);
+  }
+
+  // symbol table
+  for(std::size_t i = 0; i < input_nodes.size(); i++)
+  {
+    auto n_it = input_names.find(input_nodes[i]);
+    if(n_it != input_names.end())
+      out << 'i' << i << ' ' << n_it->second << '\n';
+  }
+
+  for(std::size_t i = 0; i < latches.size(); i++)
+    out << 'l' << i << ' ' << latches[i].name << '\n';
+
+  for(std::size_t i = 0; i < bad_names.size(); i++)
+    out << 'b' << i << ' ' << bad_names[i] << '\n';
+
+  for(std::size_t i = 0; i < justice_names.size(); i++)
+    out << 'j' << i << ' ' << justice_names[i] << '\n';
+}
@@ -0,0 +1,167 @@
+/*******************************************************************\
+
+Module: Sequential Cone of Influence of a Netlist
+
+\*******************************************************************/
+
+#include "netlist_coi.h"
+
+#include <algorithm>
+#include <stack>
+
+/*******************************************************************\
+
+Function: netlist_coit::add_cone
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: mark the transitive fan-in of the given literals
+
+\*******************************************************************/
+
+void netlist_coit::add_cone(
+  const netlistt &netlist,
+  const bvt &roots,
+  std::vector<bool> &dest,
+  bool follow_latches)
+{
+  // next-state functions of the latches, by node number
+  std::map<literalt::var_not, bvt> next_state;
+
+  if(follow_latches)
+  {
+    for(const auto &var_it : netlist.var_map.map)
+    {
+      const var_mapt::vart &var = var_it.second;
+      if(var.is_latch())
+        for(const auto &bit : var.bits)
+          next_state[bit.current.var_no()].push_back(bit.next);
+    }
+  }
+
+  std::stack<literalt::var_not> queue;
+
+  auto push = [&queue, &dest](literalt l) {
+    if(!l.is_constant() && !dest[l.var_no()])
+    {
+      dest[l.var_no()] = true;
+      queue.push(l.var_no());
+    }
+  };
+
+  for(auto l : roots)
+    push(l);
+
+  while(!queue.empty())
+  {
+    auto n = queue.top();
+    queue.pop();
+
+    const aig_nodet &node = netlist.nodes[n];
+
+    if(node.is_and())
+    {
+      push(node.a);
+      push(node.b);
+    }
+    else if(follow_latches)
+    {
+      auto next_it = next_state.find(n);
+      if(next_it != next_state.end())
+        for(auto l : next_it->second)
+          push(l);
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: netlist_coit::compute
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void netlist_coit::compute(const netlistt &netlist, const bvt &roots)
+{
+  nodes.clear();
+  nodes.resize(netlist.number_of_nodes(), false);
+  initial_nodes.clear();
+  initial_nodes.resize(netlist.number_of_nodes(), false);
+
+  // The constraints restrict the behavior of the entire design,
+  // and are hence always kept.
+  bvt sequential_roots = roots;
+
+  sequential_roots.insert(
+    sequential_roots.end(),
+    netlist.constraints.begin(),
+    netlist.constraints.end());
+
+  sequential_roots.insert(
+    sequential_roots.end(),
+    netlist.transition.begin(),
+    netlist.transition.end());
+
+  add_cone(netlist, sequential_roots, nodes, true);
+
+  // The initial state constraint only matters in timeframe 0,
+  // and does not pull in any next-state functions.
+  add_cone(netlist, netlist.initial, initial_nodes, false);
+}
+
+/*******************************************************************\
+
+Function: netlist_coit::number_of_nodes
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t netlist_coit::number_of_nodes() const
+{
+  return std::count(nodes.begin(), nodes.end(), true);
+}
+
+/*******************************************************************\
+
+Function: netlist_coi_roots
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bvt netlist_coi_roots(
+  const netlistt &netlist,
+  const std::set<irep_idt> &properties)
+{
+  bvt roots;
+
+  for(auto &id : properties)
+  {
+    auto p_it = netlist.properties.find(id);
+    if(p_it == netlist.properties.end())
+      continue;
+
+    if(std::holds_alternative<netlistt::Gpt>(p_it->second))
+      roots.push_back(std::get<netlistt::Gpt>(p_it->second).p);
+    else if(std::holds_alternative<netlistt::GFpt>(p_it->second))
+      roots.push_back(std::get<netlistt::GFpt>(p_it->second).p);
+  }
+
+  return roots;
+}
@@ -0,0 +1,50 @@
+/*******************************************************************\
+
+Module: Sequential Cone of Influence of a Netlist
+
+\*******************************************************************/
+
+/// \file
+/// Sequential Cone of Influence of a Netlist
+
+#ifndef CPROVER_TRANS_NETLIST_NETLIST_COI_H
+#define CPROVER_TRANS_NETLIST_NETLIST_COI_H
+
+#include "netlist.h"
+
+#include <set>
+
+class netlist_coit
+{
+public:
+  // nodes needed in every timeframe, indexed by node number
+  std::vector<bool> nodes;
+
+  // nodes that are needed in the initial timeframe only
+  std::vector<bool> initial_nodes;
+
+  // The cone of influence of the given netlist literals,
+  // which includes the state invariant and transition constraints,
+  // and follows latches through their next-state functions.
+  void compute(const netlistt &, const bvt &roots);
+
+  bool is_in_coi(std::size_t timeframe, literalt::var_not n) const
+  {
+    return nodes[n] || (timeframe == 0 && initial_nodes[n]);
+  }
+
+  // number of nodes retained in every timeframe
+  std::size_t number_of_nodes() const;
+
+protected:
+  void add_cone(
+    const netlistt &,
+    const bvt &,
+    std::vector<bool> &,
+    bool follow_latches);
+};
+
+// the roots for the given netlist properties
+bvt netlist_coi_roots(const netlistt &, const std::set<irep_idt> &properties);
+
+#endif // CPROVER_TRANS_NETLIST_NETLIST_COI_H
@@ -31,6 +31,81 @@ Author: Daniel Kroening, kroening@kroening.com
 
 /*******************************************************************\
 
+Function: to_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+irept to_irep(const trans_tracet &trace)
+{
+  irept result;
+  result.set(ID_mode, trace.mode);
+
+  for(const auto &state : trace.states)
+  {
+    irept state_irep;
+    state_irep.set("property_failed", state.property_failed ? 1 : 0);
+
+    for(const auto &assignment : state.assignments)
+    {
+      irept assignment_irep;
+      assignment_irep.add(ID_lhs) = assignment.lhs;
+      assignment_irep.add(ID_rhs) = assignment.rhs;
+      assignment_irep.add(ID_location) = assignment.location;
+      state_irep.get_sub().push_back(std::move(assignment_irep));
+    }
+
+    result.get_sub().push_back(std::move(state_irep));
+  }
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: trans_trace_from_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+trans_tracet trans_trace_from_irep(const irept &irep)
+{
+  trans_tracet trace;
+  trace.mode = id2string(irep.get(ID_mode));
+
+  for(const auto &state_irep : irep.get_sub())
+  {
+    trans_tracet::statet state;
+    state.property_failed = state_irep.get_bool("property_failed");
+
+    for(const auto &assignment_irep : state_irep.get_sub())
+    {
+      trans_tracet::statet::assignmentt assignment;
+      assignment.lhs = static_cast<const exprt &>(assignment_irep.find(ID_lhs));
+      assignment.rhs = static_cast<const exprt &>(assignment_irep.find(ID_rhs));
+      const auto &location = assignment_irep.find(ID_location);
+      assignment.location = static_cast<const source_locationt &>(location);
+      state.assignments.push_back(std::move(assignment));
+    }
+
+    trace.states.push_back(std::move(state));
+  }
+
+  return trace;
+}
+
+/*******************************************************************\
+
 Function: trans_tracet::get_max_failing_timeframe
 
   Inputs:
@@ -58,6 +58,14 @@ public:
   std::optional<std::size_t> get_min_failing_timeframe() const;
 };
 
+// passing traces between processes
+
+/// Converts the trace into an irep, for use with irep_serializationt.
+irept to_irep(const trans_tracet &);
+
+/// The inverse of to_irep.
+trans_tracet trans_trace_from_irep(const irept &);
+
 // outputting traces
 
 jsont json(const trans_tracet &, const namespacet &);
@@ -6,6 +6,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 \*******************************************************************/
 
+#include <algorithm>
 #include <ctime>
 #include <cassert>
 #include <string>
@@ -122,7 +123,19 @@ trans_tracet compute_trans_trace(
       // we show latches, inputs, wires      
       if(!var.is_latch() && !var.is_input() && !var.is_wire())
         continue;
-        
+
+      // skip variables outside of the cone of influence
+      if(std::any_of(
+           var.bits.begin(),
+           var.bits.end(),
+           [&bmc_map, t](const var_mapt::vart::bitt &bit) {
+             return !bit.current.is_constant() &&
+                    !bmc_map.is_mapped(t, bit.current.var_no());
+           }))
+      {
+        continue;
+      }
+
       const symbolt &symbol=ns.lookup(it->first);
 
       std::string value;
@@ -164,3 +177,79 @@ trans_tracet compute_trans_trace(
   return dest;
 }         
           
+
+/*******************************************************************\
+
+Function: compute_trans_trace
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+trans_tracet compute_trans_trace(
+  literalt property,
+  const netlistt &netlist,
+  const std::vector<std::vector<bool>> &var_values,
+  const namespacet &ns)
+{
+  trans_tracet dest;
+
+  dest.states.reserve(var_values.size());
+
+  for(const auto &timeframe_values : var_values)
+  {
+    PRECONDITION(timeframe_values.size() == netlist.nodes.size());
+
+    // the AND nodes are in topological order
+    std::vector<bool> values = timeframe_values;
+
+    auto literal_value = [&values](literalt l) {
+      if(l.is_constant())
+        return l.is_true();
+      else
+        return values[l.var_no()] != l.sign();
+    };
+
+    for(std::size_t n = 0; n < netlist.nodes.size(); n++)
+    {
+      const auto &node = netlist.nodes[n];
+      if(node.is_and())
+        values[n] = literal_value(node.a) && literal_value(node.b);
+    }
+
+    dest.states.push_back(trans_tracet::statet());
+    trans_tracet::statet &state = dest.states.back();
+
+    for(const auto &[id, var] : netlist.var_map.map)
+    {
+      // we show latches, inputs, wires
+      if(!var.is_latch() && !var.is_input() && !var.is_wire())
+        continue;
+
+      const symbolt &symbol = ns.lookup(id);
+
+      std::string value;
+      value.reserve(var.bits.size());
+
+      for(const auto &bit : var.bits)
+        value = (literal_value(bit.current) ? '1' : '0') + value;
+
+      state.assignments.push_back(trans_tracet::statet::assignmentt());
+
+      trans_tracet::statet::assignmentt &assignment =
+        state.assignments.back();
+
+      assignment.lhs = symbol.symbol_expr();
+      assignment.rhs = bitstring_to_expr(value, var.type);
+      assignment.location.make_nil();
+    }
+
+    state.property_failed = !literal_value(property);
+  }
+
+  return dest;
+}
@@ -18,4 +18,13 @@ trans_tracet compute_trans_trace(
   const class propt &solver,
   const namespacet &);
 
+/// Computes a trace by simulating the netlist, given the values
+/// of the variable nodes in each timeframe, indexed by node number.
+/// The values given for AND nodes are ignored.
+trans_tracet compute_trans_trace(
+  literalt property,
+  const netlistt &,
+  const std::vector<std::vector<bool>> &var_values,
+  const namespacet &);
+
 #endif
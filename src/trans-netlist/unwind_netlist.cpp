@@ -60,6 +60,10 @@ void unwind(
   {
     const aig_nodet &node=netlist.get_node(literalt(n, false));
 
+    // outside of the cone of influence?
+    if(!bmc_map.is_mapped(t, n))
+      continue;
+
     if(node.is_and())
     {
       literalt la=bmc_map.translate(t, node.a);
@@ -95,6 +99,15 @@ void unwind(
           literalt l_from=bit.next;
           literalt l_to=bit.current;
 
+          // The latch is outside of the cone of influence when
+          // its next-state function is not mapped.
+          if(
+            !bmc_map.is_mapped(t + 1, l_to.var_no()) ||
+            (!l_from.is_constant() && !bmc_map.is_mapped(t, l_from.var_no())))
+          {
+            continue;
+          }
+
           solver.set_equal(
             bmc_map.translate(t, l_from),
             bmc_map.translate(t+1, l_to));
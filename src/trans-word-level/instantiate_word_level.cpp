@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <temporal-logic/temporal_expr.h>
 #include <verilog/sva_expr.h>
 
+#include "linear_lasso.h"
 #include "property.h"
 
 #include <cassert>
@@ -70,8 +71,11 @@ symbol_exprt timeframe_symbol(const mp_integer &timeframe, symbol_exprt src)
 class wl_instantiatet
 {
 public:
-  wl_instantiatet(const mp_integer &_no_timeframes, const namespacet &_ns)
-    : no_timeframes(_no_timeframes), ns(_ns)
+  wl_instantiatet(
+    const mp_integer &_no_timeframes,
+    const namespacet &_ns,
+    const linear_lassot *_linear_lasso)
+    : no_timeframes(_no_timeframes), ns(_ns), linear_lasso(_linear_lasso)
   {
   }
 
@@ -84,6 +88,7 @@ public:
 protected:
   const mp_integer &no_timeframes;
   const namespacet &ns;
+  const linear_lassot *linear_lasso;
 
   [[nodiscard]] exprt instantiate_rec(exprt, const mp_integer &t) const;
   [[nodiscard]] typet instantiate_rec(typet, const mp_integer &t) const;
@@ -243,6 +248,11 @@ exprt wl_instantiatet::instantiate_rec(exprt expr, const mp_integer &t) const
     // Note that this is trivially true when t is zero,
     // as a single state cannot demonstrate the loop.
 
+    // The linear encoding only has loops that end in the
+    // last timeframe.
+    if(linear_lasso != nullptr)
+      return linear_lasso->eventually(p, t, no_timeframes - 1);
+
     exprt::operandst conjuncts = {};
     const auto i = t;
 
@@ -344,8 +354,9 @@ exprt instantiate(
   const exprt &expr,
   const mp_integer &t,
   const mp_integer &no_timeframes,
-  const namespacet &ns)
+  const namespacet &ns,
+  const linear_lassot *linear_lasso)
 {
-  wl_instantiatet wl_instantiate(no_timeframes, ns);
+  wl_instantiatet wl_instantiate(no_timeframes, ns, linear_lasso);
   return wl_instantiate(expr, t);
 }
@@ -14,11 +14,16 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <solvers/prop/prop_conv.h>
 
+class linear_lassot;
+
+/// The operators that require a loop use the linear lasso encoding
+/// when one is given, and the lasso symbols otherwise.
 exprt instantiate(
   const exprt &expr,
   const mp_integer &current,
   const mp_integer &no_timeframes,
-  const namespacet &);
+  const namespacet &,
+  const linear_lassot * = nullptr);
 
 std::string
 timeframe_identifier(const mp_integer &timeframe, const irep_idt &identifier);
@@ -0,0 +1,294 @@
+/*******************************************************************\
+
+Module: Linear Lasso Encoding
+
+\*******************************************************************/
+
+#include "linear_lasso.h"
+
+#include <util/expr_iterator.h>
+#include <util/invariant.h>
+
+#include <temporal-logic/temporal_logic.h>
+
+#include "instantiate_word_level.h"
+#include "property.h"
+
+#include <algorithm>
+#include <string>
+
+/*******************************************************************\
+
+Function: is_eventually
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: The operators whose counterexamples require a loop
+
+\*******************************************************************/
+
+static bool is_eventually(const exprt &expr)
+{
+  return expr.id() == ID_F || expr.id() == ID_AF ||
+         expr.id() == ID_sva_s_eventually;
+}
+
+/*******************************************************************\
+
+Function: lasso_bit
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+static symbol_exprt lasso_bit(const std::string &name, const mp_integer &t)
+{
+  return timeframe_symbol(t, symbol_exprt("lasso::" + name, bool_typet()));
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::linear_lassot
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+linear_lassot::linear_lassot(
+  const std::vector<exprt> &properties,
+  const namespacet &_ns,
+  const irep_idt &module_identifier)
+  : ns(_ns), variables(lasso_variables(_ns, module_identifier))
+{
+  for(const auto &property : properties)
+  {
+    for(auto it = property.depth_cbegin(); it != property.depth_cend(); ++it)
+    {
+      if(is_eventually(*it))
+      {
+        const auto &p = to_unary_expr(*it).op();
+        if(
+          std::find(eventualities.begin(), eventualities.end(), p) ==
+          eventualities.end())
+        {
+          eventualities.push_back(p);
+        }
+      }
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::supports
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+bool linear_lassot::supports(const exprt &property)
+{
+  for(auto it = property.depth_cbegin(); it != property.depth_cend(); ++it)
+  {
+    if(is_eventually(*it) && has_temporal_operator(to_unary_expr(*it).op()))
+      return false;
+  }
+
+  return true;
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::eventuality_number
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::size_t linear_lassot::eventuality_number(const exprt &p) const
+{
+  auto it = std::find(eventualities.begin(), eventualities.end(), p);
+  INVARIANT(
+    it != eventualities.end(), "F operator must be known to the lasso");
+  return static_cast<std::size_t>(it - eventualities.begin());
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::equals_loop_state
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: The state of timeframe t equals the loop state
+
+\*******************************************************************/
+
+exprt linear_lassot::equals_loop_state(const mp_integer &t) const
+{
+  exprt::operandst conjuncts;
+  conjuncts.reserve(variables.size());
+
+  for(auto &var : variables)
+  {
+    symbol_exprt loop_var(
+      id2string(var.get_identifier()) + "@loop", var.type());
+    conjuncts.push_back(equal_exprt(timeframe_symbol(t, var), loop_var));
+  }
+
+  return conjunction(std::move(conjuncts));
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::loop_exists
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: There is a loop that starts before the given last timeframe
+
+\*******************************************************************/
+
+exprt linear_lassot::loop_exists(const mp_integer &last) const
+{
+  if(last == 0)
+    return false_exprt();
+  else
+    return lasso_bit("in-loop", last - 1);
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::add_timeframe
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void linear_lassot::add_timeframe(
+  decision_proceduret &solver,
+  const mp_integer &t)
+{
+  PRECONDITION(t == next_timeframe);
+  next_timeframe = t + 1;
+
+  // the loop may start in timeframe t
+  auto loop_start = lasso_bit("loop-start", t);
+  solver.set_to_true(implies_exprt(loop_start, equals_loop_state(t)));
+
+  // timeframe t is on the loop if the loop starts in t or earlier
+  auto in_loop = lasso_bit("in-loop", t);
+  if(t == 0)
+    solver.set_to_true(equal_exprt(in_loop, loop_start));
+  else
+  {
+    solver.set_to_true(
+      equal_exprt(in_loop, or_exprt(lasso_bit("in-loop", t - 1), loop_start)));
+  }
+
+  for(std::size_t n = 0; n < eventualities.size(); n++)
+  {
+    const auto &p = eventualities[n];
+    const std::string name = "F" + std::to_string(n);
+
+    // p holds on the loop in timeframe t or earlier
+    auto on_loop = lasso_bit(name + "-on-loop", t);
+    exprt on_loop_t = and_exprt(in_loop, instantiate(p, t, t + 1, ns));
+    if(t != 0)
+      on_loop_t = or_exprt(lasso_bit(name + "-on-loop", t - 1), on_loop_t);
+    solver.set_to_true(equal_exprt(on_loop, on_loop_t));
+
+    // F p in timeframe t-1 is now defined by timeframe t
+    if(t != 0)
+    {
+      solver.set_to_true(equal_exprt(
+        lasso_bit(name, t - 1),
+        or_exprt(instantiate(p, t - 1, t, ns), lasso_bit(name, t))));
+    }
+  }
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::close
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt linear_lassot::close(const mp_integer &last) const
+{
+  PRECONDITION(last < next_timeframe);
+
+  exprt::operandst conjuncts;
+
+  // the last timeframe goes back to the start of the loop
+  conjuncts.push_back(
+    implies_exprt(loop_exists(last), equals_loop_state(last)));
+
+  // F p in the last timeframe holds if p holds somewhere on the loop
+  for(std::size_t n = 0; n < eventualities.size(); n++)
+  {
+    const std::string name = "F" + std::to_string(n);
+    conjuncts.push_back(equal_exprt(
+      lasso_bit(name, last),
+      or_exprt(
+        instantiate(eventualities[n], last, last + 1, ns),
+        lasso_bit(name + "-on-loop", last))));
+  }
+
+  return conjunction(std::move(conjuncts));
+}
+
+/*******************************************************************\
+
+Function: linear_lassot::eventually
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+exprt linear_lassot::eventually(
+  const exprt &p,
+  const mp_integer &t,
+  const mp_integer &last) const
+{
+  PRECONDITION(t <= last);
+
+  const std::string name = "F" + std::to_string(eventuality_number(p));
+
+  return or_exprt(not_exprt(loop_exists(last)), lasso_bit(name, t));
+}
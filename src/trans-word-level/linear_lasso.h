@@ -0,0 +1,75 @@
+/*******************************************************************\
+
+Module: Linear Lasso Encoding
+
+\*******************************************************************/
+
+#ifndef CPROVER_TRANS_WORD_LEVEL_LINEAR_LASSO_H
+#define CPROVER_TRANS_WORD_LEVEL_LINEAR_LASSO_H
+
+#include <util/mp_arith.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+
+#include <solvers/decision_procedure.h>
+
+#include <vector>
+
+/// A lasso encoding whose size is linear in the bound.
+/// Only loops that end in the last timeframe are considered, which
+/// loses no counterexamples, as any lasso that ends earlier can be
+/// extended by unrolling its loop.
+///
+/// Each timeframe j has a selector that says that the loop starts
+/// in j, which requires that the state of j equals the loop state,
+/// and a bit that says that j is on the loop. For the operand p of
+/// each F operator, each timeframe j has a bit that says that p
+/// holds in j or later, and a bit that accumulates whether p holds
+/// in a timeframe on the loop up to j. A timeframe thus adds a number
+/// of constraints that depends on the size of the state and the
+/// number of F operators, but not on the bound.
+///
+/// The loop is closed by comparing the last timeframe with the loop
+/// state. Those constraints hold only while that timeframe is the
+/// last one, and are hence returned by 'close' instead of being added
+/// to the solver, to allow timeframes to be added one at a time.
+class linear_lassot
+{
+public:
+  /// The F operators are taken from the given properties.
+  linear_lassot(
+    const std::vector<exprt> &properties,
+    const namespacet &,
+    const irep_idt &module_identifier);
+
+  /// Adds the constraints of timeframe t, for t=0,1,2,...
+  void add_timeframe(decision_proceduret &, const mp_integer &t);
+
+  /// The constraints that close the loop in the given last timeframe.
+  [[nodiscard]] exprt close(const mp_integer &last) const;
+
+  /// F p in timeframe t, i.e., true unless there is a loop
+  /// on which p does not hold from t onwards.
+  [[nodiscard]] exprt eventually(
+    const exprt &p,
+    const mp_integer &t,
+    const mp_integer &last) const;
+
+  /// The encoding requires that the operands of the F operators
+  /// in the given property are state predicates.
+  static bool supports(const exprt &property);
+
+protected:
+  const namespacet &ns;
+  std::vector<symbol_exprt> variables;
+
+  // the operands of the F operators
+  std::vector<exprt> eventualities;
+  mp_integer next_timeframe = 0;
+
+  std::size_t eventuality_number(const exprt &p) const;
+  exprt loop_exists(const mp_integer &last) const;
+  exprt equals_loop_state(const mp_integer &t) const;
+};
+
+#endif // CPROVER_TRANS_WORD_LEVEL_LINEAR_LASSO_H
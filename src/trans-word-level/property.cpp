@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <verilog/sva_expr.h>
 
 #include "instantiate_word_level.h"
+#include "linear_lasso.h"
 
 #include <cstdlib>
 
@@ -94,6 +95,7 @@ static void property_obligations_rec(
   const mp_integer &current,
   const mp_integer &no_timeframes,
   const namespacet &ns,
+  const linear_lassot *linear_lasso,
   std::map<mp_integer, exprt::operandst> &obligations)
 {
   PRECONDITION(current >= 0 && current < no_timeframes);
@@ -105,7 +107,7 @@ static void property_obligations_rec(
     {
       auto &op = to_X_expr(property_expr).op();
       property_obligations_rec(
-        op, solver, next, no_timeframes, ns, obligations);
+        op, solver, next, no_timeframes, ns, linear_lasso, obligations);
     }
   }
   else if(
@@ -126,7 +128,8 @@ static void property_obligations_rec(
 
     for(mp_integer c = current; c < no_timeframes; ++c)
     {
-      property_obligations_rec(phi, solver, c, no_timeframes, ns, obligations);
+      property_obligations_rec(
+        phi, solver, c, no_timeframes, ns, linear_lasso, obligations);
     }
   }
   else if(
@@ -135,6 +138,16 @@ static void property_obligations_rec(
   {
     const auto &phi = to_unary_expr(property_expr).op();
 
+    // The linear encoding only has loops that end in the
+    // last timeframe.
+    if(linear_lasso != nullptr)
+    {
+      const auto last = no_timeframes - 1;
+      obligations[last].push_back(
+        linear_lasso->eventually(phi, current, last));
+      return;
+    }
+
     // Counterexamples to Fφ must have a loop.
     // We consider l-k loops with l<k.
     for(mp_integer k = current + 1; k < no_timeframes; ++k)
@@ -193,19 +206,21 @@ static void property_obligations_rec(
 
     for(mp_integer c = from; c <= to; ++c)
     {
-      property_obligations_rec(phi, solver, c, no_timeframes, ns, obligations);
+      property_obligations_rec(
+        phi, solver, c, no_timeframes, ns, linear_lasso, obligations);
     }
   }
   else if(property_expr.id() == ID_and)
   {
     for(auto &op : to_and_expr(property_expr).operands())
       property_obligations_rec(
-        op, solver, current, no_timeframes, ns, obligations);
+        op, solver, current, no_timeframes, ns, linear_lasso, obligations);
   }
   else
   {
     // current state property
-    exprt tmp = instantiate(property_expr, current, no_timeframes, ns);
+    exprt tmp =
+      instantiate(property_expr, current, no_timeframes, ns, linear_lasso);
     obligations[current].push_back(tmp);
   }
 }
@@ -226,12 +241,13 @@ static std::map<mp_integer, exprt::operandst> property_obligations(
   const exprt &property_expr,
   decision_proceduret &solver,
   const mp_integer &no_timeframes,
-  const namespacet &ns)
+  const namespacet &ns,
+  const linear_lassot *linear_lasso)
 {
   std::map<mp_integer, exprt::operandst> obligations;
 
   property_obligations_rec(
-    property_expr, solver, 0, no_timeframes, ns, obligations);
+    property_expr, solver, 0, no_timeframes, ns, linear_lasso, obligations);
 
   return obligations;
 }
@@ -254,13 +270,14 @@ void property(
   message_handlert &message_handler,
   decision_proceduret &solver,
   std::size_t no_timeframes,
-  const namespacet &ns)
+  const namespacet &ns,
+  const linear_lassot *linear_lasso)
 {
   // The first element of the pair is the length of the
   // counterexample, and the second is the condition that
   // must be valid for the property to hold.
-  auto obligations =
-    property_obligations(property_expr, solver, no_timeframes, ns);
+  auto obligations = property_obligations(
+    property_expr, solver, no_timeframes, ns, linear_lasso);
 
   // Map obligations onto timeframes.
   prop_handles.resize(no_timeframes, true_exprt());
@@ -331,7 +348,7 @@ symbol_exprt lasso_symbol(const mp_integer &k, const mp_integer &i)
 
 /*******************************************************************\
 
-Function: lasso_constraints
+Function: state_variables
 
   Inputs:
 
@@ -341,19 +358,11 @@ Function: lasso_constraints
 
 \*******************************************************************/
 
-void lasso_constraints(
-  decision_proceduret &solver,
-  const mp_integer &no_timeframes,
-  const namespacet &ns,
-  const irep_idt &module_identifier)
+std::vector<symbol_exprt>
+state_variables(const namespacet &ns, const irep_idt &module_identifier)
 {
-  // The definition of a lasso to state s_i is that there
-  // is an identical state s_k = s_i with k<i.
-  // "Identical" is defined as "state variables and top-level inputs match".
-
-  std::vector<symbol_exprt> variables_to_compare;
+  std::vector<symbol_exprt> result;
 
-  // Gather the state variables.
   const symbol_tablet &symbol_table = ns.get_symbol_table();
   auto lower = symbol_table.symbol_module_map.lower_bound(module_identifier);
   auto upper = symbol_table.symbol_module_map.upper_bound(module_identifier);
@@ -363,9 +372,35 @@ void lasso_constraints(
     const symbolt &symbol = ns.lookup(it->second);
 
     if(symbol.is_state_var)
-      variables_to_compare.push_back(symbol.symbol_expr());
+      result.push_back(symbol.symbol_expr());
   }
 
+  return result;
+}
+
+/*******************************************************************\
+
+Function: lasso_variables
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+std::vector<symbol_exprt>
+lasso_variables(const namespacet &ns, const irep_idt &module_identifier)
+{
+  // The definition of a lasso to state s_i is that there
+  // is an identical state s_k = s_i with k<i.
+  // "Identical" is defined as "state variables and top-level inputs match".
+
+  // Gather the state variables.
+  std::vector<symbol_exprt> variables_to_compare =
+    state_variables(ns, module_identifier);
+
   // gather the top-level inputs
   const auto &module_symbol = ns.lookup(module_identifier);
   DATA_INVARIANT(module_symbol.type.id() == ID_module, "expected a module");
@@ -382,6 +417,29 @@ void lasso_constraints(
     }
   }
 
+  return variables_to_compare;
+}
+
+/*******************************************************************\
+
+Function: lasso_constraints
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void lasso_constraints(
+  decision_proceduret &solver,
+  const mp_integer &no_timeframes,
+  const namespacet &ns,
+  const irep_idt &module_identifier)
+{
+  const auto variables_to_compare = lasso_variables(ns, module_identifier);
+
   for(mp_integer i = 1; i < no_timeframes; ++i)
   {
     for(mp_integer k = 0; k < i; ++k)
@@ -396,6 +454,34 @@ void lasso_constraints(
 
 /*******************************************************************\
 
+Function: lasso_constraints_timeframe
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void lasso_constraints_timeframe(
+  decision_proceduret &solver,
+  const mp_integer &i,
+  const namespacet &ns,
+  const irep_idt &module_identifier)
+{
+  const auto variables_to_compare = lasso_variables(ns, module_identifier);
+
+  for(mp_integer k = 0; k < i; ++k)
+  {
+    auto lasso_symbol = ::lasso_symbol(k, i);
+    auto equal = states_equal(k, i, variables_to_compare);
+    solver.set_to_true(equal_exprt(lasso_symbol, equal));
+  }
+}
+
+/*******************************************************************\
+
 Function: requires_lasso_constraints
 
   Inputs:
@@ -13,16 +13,24 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/message.h>
 #include <util/mp_arith.h>
 #include <util/namespace.h>
+#include <util/std_expr.h>
 
 #include <solvers/decision_procedure.h>
 
+#include <vector>
+
+class linear_lassot;
+
+/// The property obligations that require a loop use the linear
+/// lasso encoding when one is given, and the lasso symbols otherwise.
 void property(
   const exprt &property_expr,
   exprt::operandst &prop_handles,
   message_handlert &,
   decision_proceduret &solver,
   std::size_t no_timeframes,
-  const namespacet &);
+  const namespacet &,
+  const linear_lassot * = nullptr);
 
 /// Is the given property supported by word-level unwinding?
 bool bmc_supports_property(const exprt &);
@@ -35,6 +43,30 @@ void lasso_constraints(
   const namespacet &,
   const irep_idt &module_identifier);
 
+/// Adds the lasso constraints for the loops that end in timeframe i,
+/// for unwinding one timeframe at a time.
+void lasso_constraints_timeframe(
+  decision_proceduret &,
+  const mp_integer &i,
+  const namespacet &,
+  const irep_idt &module_identifier);
+
+/// The state variables of the given module.
+std::vector<symbol_exprt>
+state_variables(const namespacet &, const irep_idt &module_identifier);
+
+/// The variables that are compared to detect a loop, i.e., the
+/// state variables and the top-level inputs of the given module.
+std::vector<symbol_exprt>
+lasso_variables(const namespacet &, const irep_idt &module_identifier);
+
+/// The conjunction of the equalities of the given variables
+/// in timeframes k and i. Precondition: k<i
+exprt states_equal(
+  const mp_integer &k,
+  const mp_integer &i,
+  const std::vector<symbol_exprt> &variables_to_compare);
+
 /// Is there a loop from i back to k?
 /// Precondition: k<i
 symbol_exprt lasso_symbol(const mp_integer &k, const mp_integer &i);
@@ -10,71 +10,121 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/find_symbols.h>
 #include <util/expr_util.h>
 
+#include <optional>
+
 #include "instantiate_word_level.h"
 #include "unwind.h"
 
 /*******************************************************************\
 
-Function: unwind
+Function: unwind_timeframe
 
   Inputs:
 
  Outputs:
 
- Purpose:
+ Purpose: Unwind a single timeframe. When the timeframe is part of
+          an unwinding of 'no_timeframes' timeframes, the progress
+          messages for the whole unwinding are given with it.
 
 \*******************************************************************/
 
-void unwind(
+static void unwind_timeframe(
   const transt &trans,
-  message_handlert &message_handler,
+  messaget &message,
   decision_proceduret &decision_procedure,
-  std::size_t no_timeframes,
+  std::size_t t,
+  std::optional<std::size_t> no_timeframes,
   const namespacet &ns,
   bool initial_state)
 {
-  messaget message{message_handler};
   const exprt &op_invar=trans.invar();
   const exprt &op_init=trans.init();
   const exprt &op_trans=trans.trans();
 
-  // in-state constraints
+  // The in-state constraints and the transition relation
+  // do not depend on the number of timeframes.
+  const std::size_t no_timeframes_so_far = t + 1;
 
-  message.progress() << "In-state constraints" << messaget::eom;
+  if(no_timeframes.has_value() && t == 0)
+    message.progress() << "In-state constraints" << messaget::eom;
 
   if(!op_invar.is_true())
-    for(std::size_t c = 0; c < no_timeframes; c++)
-      decision_procedure.set_to_true(
-        instantiate(op_invar, c, no_timeframes, ns));
-
-  // initial state
+    decision_procedure.set_to_true(
+      instantiate(op_invar, t, no_timeframes_so_far, ns));
 
-  if(initial_state)
+  if(initial_state && t == 0)
   {
     message.progress() << "Initial state" << messaget::eom;
 
     if(!op_init.is_true())
       decision_procedure.set_to_true(
-        instantiate(op_init, 0, no_timeframes, ns));
+        instantiate(op_init, 0, no_timeframes_so_far, ns));
   }
 
-  // transition relation
+  if(no_timeframes.has_value() && t == 0)
+    message.progress() << "Transition relation" << messaget::eom;
 
-  message.progress() << "Transition relation" << messaget::eom;
+  if(no_timeframes.has_value() && t + 1 == *no_timeframes)
+    message.progress() << "Transition " << t << messaget::eom;
+  else
+    message.progress() << "Transition " << t << "->" << t + 1
+                       << messaget::eom;
 
   if(!op_trans.is_true())
-    for(std::size_t t = 0; t < no_timeframes; t++)
-    {
-      // do transitions
-      bool last=(t==no_timeframes-1);
+    decision_procedure.set_to_true(
+      instantiate(op_trans, t, no_timeframes_so_far, ns));
+}
 
-      if(last)
-        message.progress() << "Transition " << t << messaget::eom;
-      else
-        message.progress() << "Transition " << t << "->" << t + 1
-                           << messaget::eom;
+/*******************************************************************\
 
-      decision_procedure.set_to_true(
-        instantiate(op_trans, t, no_timeframes, ns));
-    }
+Function: unwind_timeframe
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Unwind a single timeframe
+
+\*******************************************************************/
+
+void unwind_timeframe(
+  const transt &trans,
+  message_handlert &message_handler,
+  decision_proceduret &decision_procedure,
+  std::size_t t,
+  const namespacet &ns,
+  bool initial_state)
+{
+  messaget message{message_handler};
+
+  unwind_timeframe(
+    trans, message, decision_procedure, t, {}, ns, initial_state);
+}
+
+/*******************************************************************\
+
+Function: unwind
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void unwind(
+  const transt &trans,
+  message_handlert &message_handler,
+  decision_proceduret &decision_procedure,
+  std::size_t no_timeframes,
+  const namespacet &ns,
+  bool initial_state)
+{
+  messaget message{message_handler};
+
+  for(std::size_t t = 0; t < no_timeframes; t++)
+    unwind_timeframe(
+      trans, message, decision_procedure, t, no_timeframes, ns, initial_state);
 }
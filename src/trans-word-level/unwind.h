@@ -23,4 +23,16 @@ void unwind(
   const class namespacet &,
   bool initial_state = true);
 
+/// Adds the constraints for timeframe t only, i.e., the in-state
+/// constraints for t and the transition from t to t+1, and the
+/// initial state when t is zero. Calling this for t=0,1,...,n-1
+/// yields the same formula as unwinding n timeframes at once.
+void unwind_timeframe(
+  const transt &,
+  message_handlert &,
+  class decision_proceduret &,
+  std::size_t timeframe,
+  const class namespacet &,
+  bool initial_state = true);
+
 #endif
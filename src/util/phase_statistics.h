@@ -0,0 +1,177 @@
+/*******************************************************************\
+
+Module: Time and Memory Used by the Phases of the Tool
+
+\*******************************************************************/
+
+/// \file
+/// Time and Memory Used by the Phases of the Tool
+
+#ifndef HW_CBMC_UTIL_PHASE_STATISTICS_H
+#define HW_CBMC_UTIL_PHASE_STATISTICS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+/// The current resident set size of the process in bytes,
+/// or zero if not available.
+inline std::size_t current_resident_set_size()
+{
+#ifdef __linux__
+  // the second field is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  std::size_t size, resident;
+  if(!(statm >> size >> resident))
+    return 0;
+  return resident * std::size_t(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+class phase_timert;
+
+/// The wall-clock time spent in each phase of the tool, and the
+/// change of the resident set size during the phase, both not counting
+/// nested phases. Further, the largest resident set size when leaving
+/// the phase. The phases are kept in the order in which they are first
+/// entered.
+class phase_statisticst
+{
+public:
+  struct phaset
+  {
+    std::string name;
+    double seconds = 0;
+    std::size_t count = 0;
+    std::size_t rss = 0;
+    long long rss_growth = 0;
+  };
+
+  using phasest = std::vector<phaset>;
+
+  const phasest &phases() const
+  {
+    return _phases;
+  }
+
+  /// A table with one row per phase.
+  void output(std::ostream &out) const
+  {
+    out << std::left << std::setw(16) << "Phase" << std::right << std::setw(8)
+        << "Count" << std::setw(12) << "Time (s)" << std::setw(12)
+        << "RSS (MiB)" << std::setw(14) << "+RSS (MiB)";
+
+    for(auto &phase : _phases)
+    {
+      out << '\n'
+          << std::left << std::setw(16) << phase.name << std::right
+          << std::setw(8) << phase.count << std::setw(12) << std::fixed
+          << std::setprecision(3) << phase.seconds << std::setw(12)
+          << std::setprecision(1) << phase.rss / 1048576.0 << std::setw(14)
+          << phase.rss_growth / 1048576.0;
+    }
+
+    out << std::defaultfloat;
+  }
+
+  static phase_statisticst &instance()
+  {
+    static phase_statisticst statistics;
+    return statistics;
+  }
+
+protected:
+  friend class phase_timert;
+
+  phasest _phases;
+
+  // the timers that are running, innermost last
+  std::vector<phase_timert *> running;
+
+  phaset &phase(const std::string &name)
+  {
+    for(auto &phase : _phases)
+      if(phase.name == name)
+        return phase;
+
+    _phases.push_back(phaset{name});
+    return _phases.back();
+  }
+};
+
+/// Adds the time spent in its scope, and the change of the resident
+/// set size, to the given phase of phase_statisticst. A timer that is
+/// created while another one is running pauses the other one.
+class phase_timert
+{
+public:
+  explicit phase_timert(std::string _name) : name(std::move(_name))
+  {
+    auto &statistics = phase_statisticst::instance();
+    statistics.phase(name);
+
+    start = clockt::now();
+    start_rss = current_resident_set_size();
+
+    if(!statistics.running.empty())
+      statistics.running.back()->pause(start, start_rss);
+
+    statistics.running.push_back(this);
+  }
+
+  ~phase_timert()
+  {
+    auto &statistics = phase_statisticst::instance();
+    auto now = clockt::now();
+    auto rss = current_resident_set_size();
+
+    pause(now, rss);
+
+    auto &phase = statistics.phase(name);
+    phase.seconds += seconds;
+    phase.count++;
+    phase.rss = std::max(phase.rss, rss);
+    phase.rss_growth += rss_growth;
+
+    statistics.running.pop_back();
+
+    if(!statistics.running.empty())
+    {
+      statistics.running.back()->start = now;
+      statistics.running.back()->start_rss = rss;
+    }
+  }
+
+  phase_timert(const phase_timert &) = delete;
+  phase_timert &operator=(const phase_timert &) = delete;
+
+protected:
+  using clockt = std::chrono::steady_clock;
+
+  std::string name;
+  clockt::time_point start;
+  std::size_t start_rss;
+  double seconds = 0;
+  long long rss_growth = 0;
+
+  void pause(clockt::time_point now, std::size_t rss)
+  {
+    seconds += std::chrono::duration<double>(now - start).count();
+    rss_growth +=
+      static_cast<long long>(rss) - static_cast<long long>(start_rss);
+  }
+};
+
+#endif // HW_CBMC_UTIL_PHASE_STATISTICS_H
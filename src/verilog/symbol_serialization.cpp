@@ -0,0 +1,110 @@
+/*******************************************************************\
+
+Module: Serialization of Symbols
+
+\*******************************************************************/
+
+#include "symbol_serialization.h"
+
+#include <vector>
+
+/*******************************************************************\
+
+Function: symbol_flags
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: the Boolean members of symbolt, in a fixed order
+
+\*******************************************************************/
+
+static const std::vector<bool symbolt::*> &symbol_flags()
+{
+  static const std::vector<bool symbolt::*> flags = {
+    &symbolt::is_type,
+    &symbolt::is_macro,
+    &symbolt::is_exported,
+    &symbolt::is_input,
+    &symbolt::is_output,
+    &symbolt::is_state_var,
+    &symbolt::is_property,
+    &symbolt::is_static_lifetime,
+    &symbolt::is_thread_local,
+    &symbolt::is_lvalue,
+    &symbolt::is_file_local,
+    &symbolt::is_extern,
+    &symbolt::is_volatile,
+    &symbolt::is_parameter,
+    &symbolt::is_auxiliary,
+    &symbolt::is_weak};
+
+  return flags;
+}
+
+/*******************************************************************\
+
+Function: symbol_to_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+irept symbol_to_irep(const symbolt &symbol)
+{
+  irept irep(ID_symbol);
+  irep.set(ID_name, symbol.name);
+  irep.add(ID_type) = symbol.type;
+  irep.add(ID_value) = symbol.value;
+  irep.add(ID_C_source_location) = symbol.location;
+  irep.set(ID_module, symbol.module);
+  irep.set(ID_base_name, symbol.base_name);
+  irep.set(ID_mode, symbol.mode);
+  irep.set(ID_pretty_name, symbol.pretty_name);
+
+  std::string flags;
+  for(auto flag : symbol_flags())
+    flags += symbol.*flag ? '1' : '0';
+  irep.set("flags", irep_idt(flags));
+
+  return irep;
+}
+
+/*******************************************************************\
+
+Function: symbol_from_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+symbolt symbol_from_irep(const irept &irep)
+{
+  symbolt symbol;
+  symbol.name = irep.get(ID_name);
+  symbol.type = static_cast<const typet &>(irep.find(ID_type));
+  symbol.value = static_cast<const exprt &>(irep.find(ID_value));
+  symbol.location =
+    static_cast<const source_locationt &>(irep.find(ID_C_source_location));
+  symbol.module = irep.get(ID_module);
+  symbol.base_name = irep.get(ID_base_name);
+  symbol.mode = irep.get(ID_mode);
+  symbol.pretty_name = irep.get(ID_pretty_name);
+
+  const std::string flags = irep.get_string("flags");
+  const auto &members = symbol_flags();
+
+  for(std::size_t i = 0; i < members.size() && i < flags.size(); i++)
+    symbol.*members[i] = flags[i] == '1';
+
+  return symbol;
+}
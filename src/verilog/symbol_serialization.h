@@ -0,0 +1,19 @@
+/*******************************************************************\
+
+Module: Serialization of Symbols
+
+\*******************************************************************/
+
+#ifndef CPROVER_VERILOG_SYMBOL_SERIALIZATION_H
+#define CPROVER_VERILOG_SYMBOL_SERIALIZATION_H
+
+#include <util/symbol.h>
+
+/// Converts a symbol, including its flags, into an irep,
+/// for use with irep_serializationt.
+irept symbol_to_irep(const symbolt &);
+
+/// The inverse of symbol_to_irep.
+symbolt symbol_from_irep(const irept &);
+
+#endif // CPROVER_VERILOG_SYMBOL_SERIALIZATION_H
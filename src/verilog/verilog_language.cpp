@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <sstream>
 
+#include <util/phase_statistics.h>
 #include <util/suffix.h>
 #include <util/symbol_table.h>
 
@@ -36,6 +37,7 @@ void verilog_languaget::set_language_options(
 {
   force_systemverilog = options.get_bool_option("force-systemverilog");
   vl2smv_extensions = options.get_bool_option("vl2smv-extensions");
+  jobs = options.get_unsigned_int_option("jobs");
 }
 
 /*******************************************************************\
@@ -57,10 +59,11 @@ bool verilog_languaget::parse(
 {
   verilog_parsert verilog_parser;
 
-  std::stringstream str;
-
-  if(preprocess(instream, path, str, message_handler))
-    return true;
+  // The scanner reads the output of the preprocessor as it is
+  // produced.
+  verilog_preprocessor_streambuft preprocessed(
+    instream, message_handler, path);
+  std::istream str(&preprocessed);
 
   verilog_parser.set_file(path);
   verilog_parser.in=&str;
@@ -76,7 +79,11 @@ bool verilog_languaget::parse(
 
   bool result=verilog_parser.parse();
 
+  if(preprocessed.has_error())
+    result=true;
+
   parse_tree.swap(verilog_parser.parse_tree);
+  parse_tree.included_files = preprocessed.get_included_files();
 
   return result;
 }
@@ -176,12 +183,15 @@ bool verilog_languaget::typecheck(
 {
   if(module=="") return false;
 
-  if(verilog_typecheck(parse_tree, symbol_table, module, message_handler))
+  if(verilog_typecheck(
+       parse_tree, symbol_table, module, message_handler, jobs))
     return true;
 
   messaget message(message_handler);
   message.debug() << "Synthesis " << module << messaget::eom;
 
+  phase_timert timer("synthesis");
+
   if(verilog_synthesis(symbol_table, module, message_handler, options))
     return true;
 
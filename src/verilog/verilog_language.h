@@ -96,6 +96,7 @@ public:
 protected:
   bool force_systemverilog = false;
   bool vl2smv_extensions = false;
+  std::size_t jobs = 1;
   verilog_parse_treet parse_tree;
 };
  
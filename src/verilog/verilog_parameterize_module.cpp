@@ -7,13 +7,28 @@ Author: Daniel Kroening, kroening@kroening.com
 \*******************************************************************/
 
 #include <util/ebmc_util.h>
+#include <util/irep_serialization.h>
 #include <util/replace_symbol.h>
 #include <util/simplify_expr.h>
+#include <util/tempfile.h>
+#include <util/unicode.h>
 
 #include "verilog_typecheck.h"
 
+#include "symbol_serialization.h"
 #include "verilog_expr.h"
 
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <unordered_set>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /*******************************************************************\
 
 Function: verilog_typecheckt::get_parameter_declarators
@@ -191,7 +206,7 @@ void verilog_typecheckt::set_parameter_values(
 
 /*******************************************************************\
 
-Function: verilog_typecheckt::parameterize_module
+Function: verilog_typecheckt::parameterized_module_identifier
 
   Inputs:
 
@@ -201,31 +216,10 @@ Function: verilog_typecheckt::parameterize_module
 
 \*******************************************************************/
 
-irep_idt verilog_typecheckt::parameterize_module(
-  const source_locationt &location,
+irep_idt verilog_typecheckt::parameterized_module_identifier(
   const irep_idt &module_identifier,
-  const exprt::operandst &parameter_assignments,
-  const std::map<irep_idt, exprt> &instance_defparams)
+  const std::list<exprt> &parameter_values)
 {
-  // No parameters assigned? Nothing to do.
-  if(parameter_assignments.empty() && instance_defparams.empty())
-    return module_identifier;
-
-  // find base symbol
-  
-  symbol_tablet::symbolst::const_iterator it=
-    symbol_table.symbols.find(module_identifier);
-  
-  if(it==symbol_table.symbols.end())
-    throw errort().with_location(location) << "module not found";
-
-  const symbolt &base_symbol=it->second;
-
-  auto parameter_values = get_parameter_values(
-    to_verilog_module_source(base_symbol.type.find(ID_module_source)),
-    parameter_assignments,
-    instance_defparams);
-
   // Create full parameterized module name by appending a suffix
   // to the name of the instantiated module.
   std::string suffix="(";
@@ -255,7 +249,48 @@ irep_idt verilog_typecheckt::parameterize_module(
 
   suffix+=')';
 
-  irep_idt new_module_identifier=id2string(module_identifier)+suffix;
+  return id2string(module_identifier)+suffix;
+}
+
+/*******************************************************************\
+
+Function: verilog_typecheckt::parameterize_module
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+irep_idt verilog_typecheckt::parameterize_module(
+  const source_locationt &location,
+  const irep_idt &module_identifier,
+  const exprt::operandst &parameter_assignments,
+  const std::map<irep_idt, exprt> &instance_defparams)
+{
+  // No parameters assigned? Nothing to do.
+  if(parameter_assignments.empty() && instance_defparams.empty())
+    return module_identifier;
+
+  // find base symbol
+  
+  symbol_tablet::symbolst::const_iterator it=
+    symbol_table.symbols.find(module_identifier);
+  
+  if(it==symbol_table.symbols.end())
+    throw errort().with_location(location) << "module not found";
+
+  const symbolt &base_symbol=it->second;
+
+  auto parameter_values = get_parameter_values(
+    to_verilog_module_source(base_symbol.type.find(ID_module_source)),
+    parameter_assignments,
+    instance_defparams);
+
+  irep_idt new_module_identifier =
+    parameterized_module_identifier(module_identifier, parameter_values);
 
   if(symbol_table.symbols.find(new_module_identifier)!=
      symbol_table.symbols.end())
@@ -289,6 +324,7 @@ irep_idt verilog_typecheckt::parameterize_module(
   // recursive call
 
   verilog_typecheckt verilog_typecheck(*new_symbol, symbol_table, get_message_handler());
+  verilog_typecheck.jobs = jobs;
 
   if(verilog_typecheck.typecheck_main())
     throw 0;
@@ -296,3 +332,261 @@ irep_idt verilog_typecheckt::parameterize_module(
   return new_module_identifier;
 }
 
+
+/*******************************************************************\
+
+   Class: recording_message_handlert
+
+ Purpose: keeps the messages of a worker process,
+          to be printed by the parent
+
+\*******************************************************************/
+
+class recording_message_handlert : public message_handlert
+{
+public:
+  void print(unsigned level, const std::string &message) override
+  {
+    message_handlert::print(level, message);
+    messages.emplace_back(level, message);
+  }
+
+  void flush(unsigned) override
+  {
+  }
+
+  std::vector<std::pair<unsigned, std::string>> messages;
+};
+
+/*******************************************************************\
+
+Function: verilog_typecheckt::parameterize_modules_in_parallel
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: Type checks the parameterized modules instantiated by
+          the given module in up to 'jobs' worker processes, as the
+          symbol table is not thread-safe. The workers pass back the
+          new symbols and their messages in serialized form, which
+          are added in a fixed order. Anything not done here, say
+          owing to an error, is done by convert_inst, which then
+          also reports the error.
+
+\*******************************************************************/
+
+void verilog_typecheckt::parameterize_modules_in_parallel(
+  const verilog_module_exprt &verilog_module_expr)
+{
+#ifndef _WIN32
+  struct parameterizationt
+  {
+    source_locationt location;
+    irep_idt module_identifier;
+    exprt::operandst parameter_assignments;
+    std::map<irep_idt, exprt> defparams;
+  };
+
+  // The parameterized modules that are not in the symbol table
+  // yet, by identifier. The instances in generate blocks may
+  // depend on genvars, and are left to convert_inst.
+  std::map<irep_idt, parameterizationt> parameterizations;
+
+  for(auto &item : verilog_module_expr.module_items())
+  {
+    if(item.id() != ID_inst)
+      continue;
+
+    auto &inst = to_verilog_inst(item);
+
+    const irep_idt module_identifier =
+      verilog_module_symbol(id2string(inst.get_module()));
+
+    auto base_symbol_it = symbol_table.symbols.find(module_identifier);
+    if(base_symbol_it == symbol_table.symbols.end())
+      continue;
+
+    const auto &module_source = to_verilog_module_source(
+      base_symbol_it->second.type.find(ID_module_source));
+
+    exprt::operandst parameter_assignments = inst.parameter_assignments();
+
+    try
+    {
+      convert_parameter_assignments(parameter_assignments);
+    }
+    catch(...)
+    {
+      continue;
+    }
+
+    for(auto &instance : inst.instances())
+    {
+      parameterizationt parameterization{
+        inst.source_location(), module_identifier, parameter_assignments, {}};
+
+      auto defparams_it =
+        defparams.find(hierarchical_identifier(instance.base_name()));
+
+      if(defparams_it != defparams.end())
+        parameterization.defparams = defparams_it->second;
+
+      if(
+        parameterization.parameter_assignments.empty() &&
+        parameterization.defparams.empty())
+      {
+        continue;
+      }
+
+      irep_idt identifier;
+
+      try
+      {
+        identifier = parameterized_module_identifier(
+          module_identifier,
+          get_parameter_values(
+            module_source,
+            parameterization.parameter_assignments,
+            parameterization.defparams));
+      }
+      catch(...)
+      {
+        continue;
+      }
+
+      if(symbol_table.symbols.find(identifier) == symbol_table.symbols.end())
+        parameterizations.emplace(identifier, std::move(parameterization));
+    }
+  }
+
+  if(parameterizations.size() < 2)
+    return;
+
+  const std::size_t workers = std::min(jobs, parameterizations.size());
+
+  // the symbols and messages of each worker
+  std::vector<std::unique_ptr<temporary_filet>> results;
+
+  // don't duplicate buffered output in the workers
+  std::cout.flush();
+  std::cerr.flush();
+
+  std::vector<pid_t> pids;
+
+  for(std::size_t worker = 0; worker < workers; worker++)
+  {
+    results.push_back(
+      std::make_unique<temporary_filet>("ebmc-typecheck", "irep"));
+
+    pid_t pid = fork();
+
+    if(pid == -1)
+      break; // convert_inst does the remaining ones
+
+    if(pid == 0)
+    {
+      std::unordered_set<irep_idt> existing;
+
+      for(const auto &symbol : symbol_table.symbols)
+        existing.insert(symbol.first);
+
+      recording_message_handlert recorder;
+      set_message_handler(recorder);
+      jobs = 1;
+
+      int exit_code = 0;
+
+      try
+      {
+        std::size_t index = 0;
+
+        for(const auto &entry : parameterizations)
+        {
+          if(index++ % workers != worker)
+            continue;
+
+          const auto &parameterization = entry.second;
+
+          parameterize_module(
+            parameterization.location,
+            parameterization.module_identifier,
+            parameterization.parameter_assignments,
+            parameterization.defparams);
+        }
+      }
+      catch(...)
+      {
+        exit_code = 1;
+      }
+
+      if(exit_code == 0)
+      {
+        irept result;
+
+        auto &messages = result.add("messages").get_sub();
+
+        for(const auto &[level, text] : recorder.messages)
+        {
+          messages.emplace_back(text);
+          messages.back().set_size_t("level", level);
+        }
+
+        auto &symbols = result.add("symbols").get_sub();
+
+        for(const auto &symbol : symbol_table.symbols)
+          if(existing.find(symbol.first) == existing.end())
+            symbols.push_back(symbol_to_irep(symbol.second));
+
+        std::ofstream out(
+          widen_if_needed((*results[worker])()), std::ios::binary);
+        irep_serializationt::ireps_containert ireps_container;
+        irep_serializationt(ireps_container).write_irep(out, result);
+
+        if(!out)
+          exit_code = 1;
+      }
+
+      _exit(exit_code);
+    }
+
+    pids.push_back(pid);
+  }
+
+  for(std::size_t worker = 0; worker < pids.size(); worker++)
+  {
+    int status;
+    if(
+      waitpid(pids[worker], &status, 0) == -1 || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != 0)
+    {
+      continue;
+    }
+
+    irept result;
+
+    try
+    {
+      std::ifstream in(
+        widen_if_needed((*results[worker])()), std::ios::binary);
+      irep_serializationt::ireps_containert ireps_container;
+      result = irep_serializationt(ireps_container).read_irep(in);
+    }
+    catch(...)
+    {
+      continue;
+    }
+
+    for(const auto &recorded : result.find("messages").get_sub())
+    {
+      get_message_handler().print(
+        recorded.get_size_t("level"), id2string(recorded.id()));
+    }
+
+    // Nested parameterized modules may have been done by more
+    // than one worker; the first copy is kept.
+    for(const auto &symbol : result.find("symbols").get_sub())
+      symbol_table.add(symbol_from_irep(symbol));
+  }
+#endif
+}
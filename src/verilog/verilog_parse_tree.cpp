@@ -98,6 +98,97 @@ void verilog_parse_treet::build_module_map()
 
 /*******************************************************************\
 
+Function: verilog_parse_treet::to_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+irept verilog_parse_treet::to_irep() const
+{
+  irept result;
+
+  for(const auto &item : items)
+  {
+    if(item.is_module())
+    {
+      irept module = item.verilog_module.to_irep();
+      module.id(ID_module);
+      module.add(ID_C_source_location) = item.verilog_module.location;
+      result.get_sub().push_back(std::move(module));
+    }
+    else if(item.is_typedef())
+    {
+      irept verilog_typedef(ID_typedef);
+      verilog_typedef.add(ID_symbol) = item.verilog_typedef.symbol;
+      verilog_typedef.add(ID_type) = item.verilog_typedef.type;
+      result.get_sub().push_back(std::move(verilog_typedef));
+    }
+  }
+
+  auto &files = result.add(ID_file).get_sub();
+  for(const auto &file : included_files)
+    files.emplace_back(file);
+
+  return result;
+}
+
+/*******************************************************************\
+
+Function: verilog_parse_treet::from_irep
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void verilog_parse_treet::from_irep(const irept &src)
+{
+  clear();
+
+  for(const auto &sub : src.get_sub())
+  {
+    items.push_back(itemt());
+    itemt &item = items.back();
+
+    if(sub.id() == ID_module)
+    {
+      item.type = itemt::MODULE;
+      verilog_modulet &verilog_module = item.verilog_module;
+      verilog_module.name = sub.get(ID_name);
+      verilog_module.parameter_port_list =
+        static_cast<const exprt &>(sub.find(ID_parameter_port_list));
+      verilog_module.ports = static_cast<const exprt &>(sub.find(ID_ports));
+      verilog_module.module_items =
+        static_cast<const exprt &>(sub.find(ID_module_items));
+      verilog_module.location =
+        static_cast<const source_locationt &>(sub.find(ID_C_source_location));
+    }
+    else
+    {
+      PRECONDITION(sub.id() == ID_typedef);
+      item.type = itemt::TYPEDEF;
+      item.verilog_typedef.symbol =
+        static_cast<const typet &>(sub.find(ID_symbol));
+      item.verilog_typedef.type = static_cast<const typet &>(sub.find(ID_type));
+    }
+  }
+
+  for(const auto &file : src.find(ID_file).get_sub())
+    included_files.push_back(id2string(file.id()));
+
+  build_module_map();
+}
+
+/*******************************************************************\
+
 Function: verilog_parse_treet::show
 
   Inputs:
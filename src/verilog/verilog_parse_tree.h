@@ -60,11 +60,15 @@ public:
 
   // for parsing expressions
   exprt expr;
+
+  // the files included by the preprocessor
+  std::vector<std::string> included_files;
   
   void clear()
   {
     expr.clear();
     items.clear();
+    included_files.clear();
   }
   
   bool has_module(const std::string &name) const
@@ -93,6 +97,7 @@ public:
     parse_tree.items.swap(items);
     parse_tree.expr.swap(expr);
     parse_tree.module_map.swap(module_map);
+    parse_tree.included_files.swap(included_files);
   }
 
   void modules_provided(
@@ -102,6 +107,10 @@ public:
   module_mapt module_map;
   
   void build_module_map();
+
+  // for passing parse trees between processes
+  irept to_irep() const;
+  void from_irep(const irept &);
   
   void show(std::ostream &out) const;
 };
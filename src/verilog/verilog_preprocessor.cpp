@@ -160,50 +160,75 @@ Function: verilog_preprocessort::preprocessor
 \*******************************************************************/
 
 void verilog_preprocessort::preprocessor()
+{
+  while(preprocessor_step())
+  {
+  }
+}
+
+/*******************************************************************\
+
+Function: verilog_preprocessort::preprocessor_step
+
+  Inputs:
+
+ Outputs: false once the input is exhausted
+
+ Purpose: processes a single token or directive
+
+\*******************************************************************/
+
+bool verilog_preprocessort::preprocessor_step()
 {
   try
   {
-    // the first context is the input file
-    context_stack.emplace_back(false, &in, filename);
+    if(!started)
+    {
+      // the first context is the input file
+      context_stack.emplace_back(false, &in, filename);
+      started = true;
+    }
+
+    if(context_stack.empty())
+      return false;
 
-    while(!context_stack.empty())
+    if(!tokenizer().eof())
     {
-      while(!tokenizer().eof())
+      // Emit line directive to get parser line count
+      // back in sync with preprocessor line count.
+      if(
+        condition && context().is_file() &&
+        parser_line_no != tokenizer().line_no())
       {
-        // Emit line directive to get parser line count
-        // back in sync with preprocessor line count.
-        if(
-          condition && context().is_file() &&
-          parser_line_no != tokenizer().line_no())
+        emit_line_directive(0); // 'neither'
+      }
+
+      // Read a token.
+      auto token = tokenizer().next_token();
+      if(token == '`')
+        directive();
+      else if(condition)
+      {
+        auto a_it = context().define_arguments.find(token.text);
+        if(a_it == context().define_arguments.end())
         {
-          emit_line_directive(0); // 'neither'
-        }
+          // Not an argument, just emit
+          out << token;
 
-        // Read a token.
-        auto token = tokenizer().next_token();
-        if(token == '`')
-          directive();
-        else if(condition)
+          // track parser line number
+          if(token == '\n')
+            parser_line_no++;
+        }
+        else
         {
-          auto a_it = context().define_arguments.find(token.text);
-          if(a_it == context().define_arguments.end())
-          {
-            // Not an argument, just emit
-            out << token;
-
-            // track parser line number
-            if(token == '\n')
-              parser_line_no++;
-          }
-          else
-          {
-            // Create a new context for the define argument.
-            // We then continue in that context.
-            context_stack.emplace_back(a_it->second);
-          }
+          // Create a new context for the define argument.
+          // We then continue in that context.
+          context_stack.emplace_back(a_it->second);
         }
       }
-
+    }
+    else
+    {
       const bool is_file = context().is_file();
       context_stack.pop_back();
 
@@ -211,6 +236,8 @@ void verilog_preprocessort::preprocessor()
       if(!context_stack.empty() && is_file)
         emit_line_directive(2); // 'exit'
     }
+
+    return !context_stack.empty();
   }
   catch(const verilog_preprocessor_errort &e)
   {
@@ -223,6 +250,66 @@ void verilog_preprocessort::preprocessor()
 
 /*******************************************************************\
 
+Function: verilog_preprocessor_streambuft::verilog_preprocessor_streambuft
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+verilog_preprocessor_streambuft::verilog_preprocessor_streambuft(
+  std::istream &in,
+  message_handlert &message_handler,
+  const std::string &filename)
+  : sink_stream(&sink), preprocessor(in, sink_stream, message_handler, filename)
+{
+}
+
+/*******************************************************************\
+
+Function: verilog_preprocessor_streambuft::underflow
+
+  Inputs:
+
+ Outputs:
+
+ Purpose: runs the preprocessor until it has produced the next chunk
+
+\*******************************************************************/
+
+auto verilog_preprocessor_streambuft::underflow() -> int_type
+{
+  if(gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+
+  try
+  {
+    while(!done && sink.buffer.size() < chunk_size)
+      done = !preprocessor.preprocessor_step();
+  }
+  catch(int)
+  {
+    error = true;
+    done = true;
+  }
+
+  // hand the chunk to the reader, and re-use the old buffer
+  buffer.swap(sink.buffer);
+  sink.buffer.clear();
+
+  if(buffer.empty())
+    return traits_type::eof();
+
+  setg(buffer.data(), buffer.data(), buffer.data() + buffer.size());
+
+  return traits_type::to_int_type(*gptr());
+}
+
+/*******************************************************************\
+
 Function: verilog_preprocessort::parse_define_parameters
 
   Inputs:
@@ -564,6 +651,8 @@ void verilog_preprocessort::directive()
     if(!*in)
       throw verilog_preprocessor_errort() << "failed to open an include file";
 
+    included_files.push_back(full_path);
+
     tokenizer().skip_until_eol();
     tokenizer().next_token(); // eat the \n
 
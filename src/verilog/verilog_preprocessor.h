@@ -10,12 +10,24 @@
 
 #include <list>
 #include <map>
+#include <ostream>
+#include <streambuf>
 
 class verilog_preprocessort:public preprocessort
 {
 public:
   virtual void preprocessor();
 
+  // Processes the next token or directive, for running the
+  // preprocessor incrementally. Returns false once done.
+  bool preprocessor_step();
+
+  // the files that have been included so far
+  const std::vector<std::string> &get_included_files() const
+  {
+    return included_files;
+  }
+
   verilog_preprocessort(
     std::istream &_in,
     std::ostream &_out,
@@ -90,6 +102,9 @@ protected:
     void get_token_from_stream() override;
   };
 
+  bool started = false;
+  std::vector<std::string> included_files;
+
   // To synchronize the parser's line number
   std::size_t parser_line_no = 0;
   void emit_line_directive(unsigned level);
@@ -155,4 +170,61 @@ protected:
   }
 };
 
+/// A stream buffer with the output of the preprocessor, which is
+/// produced in chunks as the reader consumes it. This avoids holding
+/// the entire preprocessed file in memory.
+class verilog_preprocessor_streambuft : public std::streambuf
+{
+public:
+  verilog_preprocessor_streambuft(
+    std::istream &,
+    message_handlert &,
+    const std::string &filename);
+
+  // true if the preprocessor has reported an error
+  bool has_error() const
+  {
+    return error;
+  }
+
+  const std::vector<std::string> &get_included_files() const
+  {
+    return preprocessor.get_included_files();
+  }
+
+protected:
+  // collects the output of the preprocessor
+  class sinkt : public std::streambuf
+  {
+  public:
+    std::string buffer;
+
+  protected:
+    int_type overflow(int_type ch) override
+    {
+      if(!traits_type::eq_int_type(ch, traits_type::eof()))
+        buffer.push_back(traits_type::to_char_type(ch));
+      return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override
+    {
+      buffer.append(s, n);
+      return n;
+    }
+  };
+
+  sinkt sink;
+  std::ostream sink_stream;
+  verilog_preprocessort preprocessor;
+
+  // the chunk that is being read
+  std::string buffer;
+  bool done = false, error = false;
+
+  static constexpr std::size_t chunk_size = 1 << 16;
+
+  int_type underflow() override;
+};
+
 #endif
@@ -955,29 +955,41 @@ bool verilog_synthesist::replace_symbols(
   const replace_mapt &what,
   exprt &dest)
 {
-  bool result=true;
-
   if(dest.id()==ID_next_symbol ||
      dest.id()==ID_symbol)
   {
     replace_mapt::const_iterator it=
       what.find(dest.get(ID_identifier));
 
-    if(it!=what.end())
-    {
-      bool is_next_symbol=dest.id()==ID_next_symbol;
-      dest=it->second;      
+    if(it==what.end())
+      return true;
 
-      if(is_next_symbol)
-        replace_symbols(ID_next_symbol, dest);
+    bool is_next_symbol=dest.id()==ID_next_symbol;
+    dest=it->second;      
 
-      result=false;
-    }
+    if(is_next_symbol)
+      replace_symbols(ID_next_symbol, dest);
+
+    return false;
   }
-  else
+
+  if(!dest.has_operands())
+    return true;
+
+  // Only the operands that change are written, which keeps the
+  // others shared with the original module.
+  const exprt original=dest;
+  bool result=true;
+
+  for(std::size_t i=0; i<original.operands().size(); i++)
   {
-    Forall_operands(it, dest)
-      result=replace_symbols(what, *it) && result;
+    exprt op=original.operands()[i];
+
+    if(!replace_symbols(what, op))
+    {
+      dest.operands()[i]=std::move(op);
+      result=false;
+    }
   }
 
   return result;
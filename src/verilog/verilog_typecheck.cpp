@@ -432,7 +432,7 @@ void verilog_typecheckt::convert_decl(verilog_declt &decl)
 
 /*******************************************************************\
 
-Function: verilog_typecheckt::convert_inst
+Function: verilog_typecheckt::convert_parameter_assignments
 
   Inputs:
 
@@ -442,18 +442,9 @@ Function: verilog_typecheckt::convert_inst
 
 \*******************************************************************/
 
-void verilog_typecheckt::convert_inst(verilog_instt &inst)
+void verilog_typecheckt::convert_parameter_assignments(
+  exprt::operandst &parameter_assignments)
 {
-  const irep_idt &inst_module=inst.get_module();
-
-  // The instantiated module must be user-defined.
-
-  const irep_idt module_identifier =
-    verilog_module_symbol(id2string(inst_module));
-
-  exprt::operandst &parameter_assignments=
-    inst.parameter_assignments();
-
   Forall_expr(it, parameter_assignments)
   {
     // These must be constants. Preserve the location.
@@ -469,6 +460,33 @@ void verilog_typecheckt::convert_inst(verilog_instt &inst)
       *it = from_integer(v_int, integer_typet()).with_source_location(*it);
     }
   }
+}
+
+/*******************************************************************\
+
+Function: verilog_typecheckt::convert_inst
+
+  Inputs:
+
+ Outputs:
+
+ Purpose:
+
+\*******************************************************************/
+
+void verilog_typecheckt::convert_inst(verilog_instt &inst)
+{
+  const irep_idt &inst_module=inst.get_module();
+
+  // The instantiated module must be user-defined.
+
+  const irep_idt module_identifier =
+    verilog_module_symbol(id2string(inst_module));
+
+  exprt::operandst &parameter_assignments=
+    inst.parameter_assignments();
+
+  convert_parameter_assignments(parameter_assignments);
 
   // get the instance symbols
   for(auto &instance : inst.instances())
@@ -1634,6 +1652,11 @@ void verilog_typecheckt::convert_statements(
     }
   }
 
+  // Type check the parameterized modules that are instantiated
+  // in worker processes, which is done by convert_inst otherwise.
+  if(jobs > 1)
+    parameterize_modules_in_parallel(verilog_module_expr);
+
   // typecheck the new module items
   for(auto &item : verilog_module_expr.module_items())
     convert_module_item(item);
@@ -1728,7 +1751,8 @@ bool verilog_typecheck(
   const verilog_parse_treet &parse_tree,
   symbol_table_baset &symbol_table,
   const std::string &module,
-  message_handlert &message_handler)
+  message_handlert &message_handler,
+  std::size_t jobs)
 {
   verilog_parse_treet::module_mapt::const_iterator it=
     parse_tree.module_map.find(
@@ -1743,7 +1767,7 @@ bool verilog_typecheck(
   }
 
   return verilog_typecheck(
-    symbol_table, it->second->verilog_module, message_handler);
+    symbol_table, it->second->verilog_module, message_handler, jobs);
 }
 
 /*******************************************************************\
@@ -1761,7 +1785,8 @@ Function: verilog_typecheck
 bool verilog_typecheck(
   symbol_table_baset &symbol_table,
   const verilog_modulet &verilog_module,
-  message_handlert &message_handler)
+  message_handlert &message_handler,
+  std::size_t jobs)
 {
   // create symbol
 
@@ -1791,5 +1816,6 @@ bool verilog_typecheck(
   }
 
   verilog_typecheckt verilog_typecheck(*new_symbol, symbol_table, message_handler);
+  verilog_typecheck.jobs = jobs;
   return verilog_typecheck.typecheck_main();
 }
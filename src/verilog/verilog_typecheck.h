@@ -23,12 +23,14 @@ bool verilog_typecheck(
   const verilog_parse_treet &parse_tree,
   symbol_table_baset &,
   const std::string &module,
-  message_handlert &message_handler);
+  message_handlert &message_handler,
+  std::size_t jobs = 1);
 
 bool verilog_typecheck(
   symbol_table_baset &,
   const verilog_modulet &verilog_module,
-  message_handlert &message_handler);
+  message_handlert &message_handler,
+  std::size_t jobs = 1);
 
 bool verilog_typecheck(
   symbol_table_baset &,
@@ -66,6 +68,10 @@ public:
 
   void typecheck() override;
 
+  // The number of processes used for type checking
+  // the parameterized modules that are instantiated.
+  std::size_t jobs = 1;
+
 protected:
   const namespacet ns;
   symbolt &module_symbol;
@@ -101,6 +107,12 @@ protected:
     const exprt::operandst &parameter_assignment,
     const std::map<irep_idt, exprt> &defparams);
 
+  irep_idt parameterized_module_identifier(
+    const irep_idt &module_identifier,
+    const std::list<exprt> &parameter_values);
+
+  void parameterize_modules_in_parallel(const verilog_module_exprt &);
+
   std::vector<verilog_parameter_declt::declaratort>
   get_parameter_declarators(const verilog_module_sourcet &);
 
@@ -159,6 +171,7 @@ protected:
   void convert_decl(class verilog_declt &);
   void convert_function_or_task(class verilog_declt &);
   void convert_inst(class verilog_instt &);
+  void convert_parameter_assignments(exprt::operandst &);
   void convert_inst_builtin(class verilog_inst_builtint &);
   void convert_always_base(class verilog_always_baset &);
   void convert_initial(class verilog_initialt &);